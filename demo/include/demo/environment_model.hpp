@@ -7,7 +7,9 @@
 #include "types.hpp"
 #include "utils/astar.hpp"
 #include "utils/cluster.hpp"
+#include "utils/distance_field.hpp"
 #include "utils/entities.hpp"
+#include "utils/ghost_occupancy.hpp"
 #include "utils/maze.hpp"
 
 namespace demo {
@@ -17,15 +19,26 @@ namespace demo {
  * @brief Represents the environment model for a game.
  *
  * The EnvironmentModel class serves as a centralized location for individual behaviors to query the current state of
- * the world. */
+ * the world.
+ *
+ * Derived state such as the ghosts, distance fields and ghost occupancy is built lazily on first access and cached
+ * without synchronization. The model must therefore only be queried by one thread at a time, i.e. arbitrators using
+ * behaviors or cost estimators that query it must not be configured with CostArbitrator::setNumThreads(). */
 class EnvironmentModel {
 public:
     using Cluster = utils::Cluster;
     using Clusters = utils::DotClusterFinder::Clusters;
+    using DistanceField = utils::DistanceField;
     using Entities = utils::Entities;
     using Maze = utils::Maze;
     using Ghost = utils::Ghost;
     using Ghosts = utils::Entities::Ghosts;
+    using GhostOccupancy = utils::GhostOccupancy;
+
+    /// Number of steps the ghost occupancy looks ahead. It over-approximates where ghosts could be, so looking
+    /// further ahead would reject almost every path heading towards a ghost. Distant ghosts are left to
+    /// AvoidGhostBehavior.
+    constexpr static int GhostOccupancyHorizon = 2;
 
     using Ptr = std::shared_ptr<EnvironmentModel>;
     using ConstPtr = std::shared_ptr<const EnvironmentModel>;
@@ -42,12 +55,16 @@ public:
 
     /**
      * @brief Update the environment model to reflect the current state of the world.
+     *
+     * The maze is an immutable snapshot, which is only copied if a tile changed, see Maze::updated(). Everything
+     * derived from the maze and the entities is updated incrementally or recomputed lazily on first access.
      */
     void update(const Game& game) {
-        maze_ = std::make_shared<Maze>(game.maze);
+        maze_ = Maze::updated(maze_, game.maze);
         astar_.updateMaze(maze_);
-        clusterFinder_ = utils::DotClusterFinder{maze_};
+        clusterFinder_.update(maze_);
         updateEntities(game.reg);
+        resetDerivedState();
     }
 
     Position pacmanPosition() const {
@@ -59,9 +76,21 @@ public:
     }
 
     /**
-     * @brief The currently closest ghost and the corresponding manhattan distance.
+     * @brief All ghosts, ordered as in Entities::ghosts().
+     *
+     * The ghost lists are assembled on first access after each update and reuse their memory.
+     */
+    const Ghosts& ghosts() const;
+
+    /**
+     * @brief The ghosts that are currently in the scared mode.
+     */
+    const Ghosts& scaredGhosts() const;
+
+    /**
+     * @brief The currently closest ghost and the corresponding maze distance.
      *
-     * This function uses the A* distance function so walls will be considered.
+     * This is looked up in the distance field from all ghosts, so walls will be considered.
      */
     GhostWithDistance closestGhost(const Time& time) const;
 
@@ -73,13 +102,37 @@ public:
      */
     std::optional<GhostWithDistance> closestScaredGhost(const Time& time) const;
 
+    /**
+     * @brief Maze distances from Pacman to every cell.
+     *
+     * The distance fields are computed on first access after each update and shared by all behaviors.
+     */
+    const DistanceField& distanceFieldFromPacman() const;
+
+    /**
+     * @brief Maze distances from every cell to the closest ghost. Sources are ordered as in ghosts().
+     */
+    const DistanceField& distanceFieldFromGhosts() const;
+
+    /**
+     * @brief Maze distances from every cell to the closest scared ghost. Sources are ordered as in scaredGhosts().
+     */
+    const DistanceField& distanceFieldFromScaredGhosts() const;
+
+    /**
+     * @brief The cells the dangerous (i.e. chasing or scattering) ghosts could occupy within the next steps.
+     *
+     * Computed on first access after each update, so the verifier and all behaviors share one per game tick.
+     */
+    const GhostOccupancy& ghostOccupancy() const;
+
     /**
      * @brief Returns a vector of all dot clusters.
      *
      * A dot cluster is a set of dots (including power pellets) that can be connected by a path passing through neither
      * walls nor empty space.
      */
-    Clusters dotCluster() const {
+    const Clusters& dotCluster() const {
         return clusterFinder_.clusters();
     }
 
@@ -96,15 +149,24 @@ public:
         return astar_.shortestPath(pacmanPosition(), goal);
     }
 
-    std::optional<Path> pathToClosestDot(const Position& position) const {
-        return astar_.pathToClosestDot(position);
-    }
+    /**
+     * @brief Returns the path from a given start position to the closest dot.
+     *
+     * For Pacman's position, this is answered by the distance field from Pacman, otherwise A* is used.
+     */
+    std::optional<Path> pathToClosestDot(const Position& position) const;
 
     Positions toAbsolutePath(const Path& path) const;
 
     bool isDot(const Position& position) const {
         return maze_->isDot(position);
     }
+    int dotsInRectangle(const Position& minCorner, const Position& maxCorner) const {
+        return maze_->dotsInRectangle(minCorner, maxCorner);
+    }
+    int dotsAlongPath(const Positions& absolutePath) const {
+        return maze_->dotsAlongPath(absolutePath);
+    }
     bool isWall(const Position& position) const {
         return maze_->isWall(position);
     }
@@ -121,7 +183,19 @@ public:
 protected:
     void updateEntities(const entt::Registry& registry);
 
-    GhostWithDistance closestGhost(const Ghosts& ghosts) const;
+    GhostWithDistance closestGhost(const Ghosts& ghosts, const DistanceField& distanceFieldFromGhosts) const;
+
+    /**
+     * @brief Invalidates the ghost lists and distance fields, has to be called whenever the maze or the entities
+     * changed.
+     */
+    void resetDerivedState() {
+        ghostsUpToDate_ = false;
+        distanceFieldFromPacman_.reset();
+        distanceFieldFromGhosts_.reset();
+        distanceFieldFromScaredGhosts_.reset();
+        ghostOccupancy_.reset();
+    }
 
     Entities entities_;
     Maze::ConstPtr maze_;
@@ -130,6 +204,15 @@ protected:
     utils::DotClusterFinder clusterFinder_;
     mutable util_caching::Cache<Time, GhostWithDistance> closestGhostCache_;
     mutable util_caching::Cache<Time, GhostWithDistance> closestScaredGhostCache_;
+
+    mutable bool ghostsUpToDate_{false};
+    mutable Ghosts ghosts_;
+    mutable Ghosts scaredGhosts_;
+
+    mutable DistanceField::ConstPtr distanceFieldFromPacman_;
+    mutable DistanceField::ConstPtr distanceFieldFromGhosts_;
+    mutable DistanceField::ConstPtr distanceFieldFromScaredGhosts_;
+    mutable GhostOccupancy::ConstPtr ghostOccupancy_;
 };
 
 } // namespace demo
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <random>
+
 #include <arbitration_graphs/behavior.hpp>
 #include <util_caching/cache.hpp>
 
@@ -21,10 +24,13 @@ public:
 
     struct Parameters {
         Duration selectionFixedFor{std::chrono::seconds(1)};
+        /// Seed for reproducible directions, e.g. for simulations. A random seed is used if not set.
+        std::optional<unsigned int> seed;
     };
 
     explicit MoveRandomlyBehavior(const Parameters& parameters, const std::string& name = "MoveRandomly")
-            : Behavior{name}, parameters_{parameters} {
+            : Behavior{name}, parameters_{parameters},
+              randomGenerator_{parameters.seed ? parameters.seed.value() : std::random_device{}()} {
     }
 
     Command getCommand(const Time& time) override;
@@ -38,8 +44,7 @@ private:
     util_caching::Cache<Time, Direction> directionCache_;
     Parameters parameters_;
 
-    std::random_device randomDevice_;
-    std::mt19937 randomGenerator_{randomDevice_()};
+    std::mt19937 randomGenerator_;
     std::uniform_int_distribution<> discreteRandomDistribution_{0, static_cast<int>(Move::possibleMoves().size()) - 1};
 };
 
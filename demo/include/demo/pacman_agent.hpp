@@ -36,8 +36,9 @@ public:
         CostEstimator::Parameters costEstimator;
     };
 
-    explicit PacmanAgent(const entt::Game& game)
-            : parameters_{}, environmentModel_{std::make_shared<EnvironmentModel>(game)}, verifier_{environmentModel_} {
+    explicit PacmanAgent(const entt::Game& game, const Parameters& parameters = Parameters{})
+            : environmentModel_{std::make_shared<EnvironmentModel>(game)}, parameters_{parameters},
+              verifier_{environmentModel_} {
 
         avoidGhostBehavior_ = std::make_shared<AvoidGhostBehavior>(environmentModel_, parameters_.avoidGhostBehavior);
         changeDotClusterBehavior_ = std::make_shared<ChangeDotClusterBehavior>(environmentModel_);
@@ -46,6 +47,7 @@ public:
         moveRandomlyBehavior_ = std::make_shared<MoveRandomlyBehavior>(parameters_.moveRandomlyBehavior);
         stayInPlaceBehavior_ = std::make_shared<StayInPlaceBehavior>(environmentModel_);
 
+        // Evaluated sequentially, since the behaviors share the environment model, which isn't thread-safe.
         eatDotsArbitrator_ = std::make_shared<CostArbitrator>("EatDots", verifier_);
         costEstimator_ = std::make_shared<CostEstimator>(environmentModel_, parameters_.costEstimator);
         eatDotsArbitrator_->addOption(
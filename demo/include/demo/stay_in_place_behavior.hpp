@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include <arbitration_graphs/behavior.hpp>
 
 #include "environment_model.hpp"
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <map>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -69,34 +71,35 @@ struct Command {
         return path.front();
     }
     SDL_Scancode scancode() const {
-        return scancodeMap.at(nextDirection());
+        return scancode(nextDirection());
+    }
+    static constexpr SDL_Scancode scancode(const Direction& direction) {
+        // Indexed by Direction, a shared table keeps commands cheap to construct and copy
+        constexpr std::array<SDL_Scancode, 4> scancodes{
+            SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT};
+        return scancodes[static_cast<std::size_t>(direction)];
     }
-
-    std::map<Direction, SDL_Scancode> scancodeMap{
-        {Direction::UP, SDL_SCANCODE_UP},
-        {Direction::DOWN, SDL_SCANCODE_DOWN},
-        {Direction::LEFT, SDL_SCANCODE_LEFT},
-        {Direction::RIGHT, SDL_SCANCODE_RIGHT},
-    };
 
     Path path;
 };
 
 struct Move {
-    explicit Move(const Direction& direction)
-            : direction{direction}, deltaPosition{directionDeltaPositionMap().at(direction)} {
+    explicit constexpr Move(const Direction& direction)
+            : direction{direction}, deltaPosition{directionDeltaPosition(direction)} {
     }
 
     // It would be nicer to have a static member here, but as we're self-referencing Move here, that doesn't work (incomplete type).
     // Using a static member function returning this list is still nicer than a global constant variable
-    static std::vector<Move> possibleMoves() {
-        return {Move{Direction::UP}, Move{Direction::DOWN}, Move{Direction::LEFT}, Move{Direction::RIGHT}};
+    static const std::vector<Move>& possibleMoves() {
+        static const std::vector<Move> moves{
+            Move{Direction::UP}, Move{Direction::DOWN}, Move{Direction::LEFT}, Move{Direction::RIGHT}};
+        return moves;
     }
-    static std::map<Direction, Position> directionDeltaPositionMap() {
-        return {{Direction::UP, {0, -1}},
-                {Direction::DOWN, {0, 1}},
-                {Direction::LEFT, {-1, 0}},
-                {Direction::RIGHT, {1, 0}}};
+    static constexpr Position directionDeltaPosition(const Direction& direction) {
+        // Indexed by Direction
+        constexpr std::array<Position, 4> deltaPositions{
+            Position{0, -1}, Position{0, 1}, Position{-1, 0}, Position{1, 0}};
+        return deltaPositions[static_cast<std::size_t>(direction)];
     }
 
     Direction direction;
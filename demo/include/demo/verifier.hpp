@@ -26,15 +26,22 @@ public:
     explicit Verifier(EnvironmentModel::Ptr environmentModel) : environmentModel_{std::move(environmentModel)} {
     }
 
+    /**
+     * @brief Accepts a command if its next step is passable and none of its first steps (up to
+     * EnvironmentModel::GhostOccupancyHorizon) enters a cell a ghost could reach at the same time.
+     */
     VerificationResult analyze(const Time /*time*/, const Command& command) const {
         Move nextMove = Move{command.path.front()};
         Position nextPosition = environmentModel_->pacmanPosition() + nextMove.deltaPosition;
 
-        if (environmentModel_->isPassableCell(nextPosition)) {
-            return VerificationResult{true};
+        if (!environmentModel_->isPassableCell(nextPosition)) {
+            return VerificationResult{false};
+        }
+        if (environmentModel_->ghostOccupancy().firstCollision(environmentModel_->pacmanPosition(), command.path)) {
+            return VerificationResult{false};
         }
 
-        return VerificationResult{false};
+        return VerificationResult{true};
     }
 
 private:
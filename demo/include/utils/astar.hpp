@@ -1,14 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <optional>
-#include <queue>
 #include <utility>
 #include <vector>
 
-#include <util_caching/cache.hpp>
-
 #include "demo/types.hpp"
+#include "utils/distance_table.hpp"
 #include "utils/maze.hpp"
 
 namespace utils {
@@ -17,43 +16,68 @@ using Path = demo::Path;
 using Position = demo::Position;
 using TileType = demo::TileType;
 
-struct AStarCell : public BaseCell {
-    using Move = demo::Move;
-
-    struct CompareCells {
-        bool operator()(const AStarCell& left, const AStarCell& right) {
-            return (left.distanceFromStart + left.heuristic) > (right.distanceFromStart + right.heuristic);
+/**
+ * @brief Persistent per-cell state of the A* search, reused between the queries of a thread to avoid allocations.
+ *
+ * Instead of re-initializing every cell for each query, cells are stamped with the generation (i.e. query) they have
+ * last been written in. A cell with an outdated stamp is treated as unvisited. The open list only holds cell indices
+ * and their priorities.
+ */
+struct AStarWorkspace {
+    constexpr static std::int8_t NoMove = -1;
+
+    struct OpenListEntry {
+        double priority;
+        int cellIndex;
+    };
+    struct CompareEntries {
+        bool operator()(const OpenListEntry& left, const OpenListEntry& right) const {
+            return left.priority > right.priority;
         }
     };
 
-    AStarCell(const Position& position, const TileType& type) : BaseCell(position, type) {};
-
-    bool visited{false};
-    int distanceFromStart{std::numeric_limits<int>::max()};
-    double heuristic{std::numeric_limits<int>::max()};
-    std::optional<Move> moveFromPredecessor;
+    /**
+     * @brief Prepares the workspace for a new query on a maze with the given number of cells.
+     */
+    void startQuery(const int& numCells);
 
-    double manhattanDistance(const Position& other) const {
-        return std::abs(position.x - other.x) + std::abs(position.y - other.y);
+    /**
+     * @brief Lazily resets the state of the given cell if it has not been touched in the current query.
+     */
+    void touch(const int& cellIndex) {
+        if (generations[cellIndex] != currentGeneration) {
+            generations[cellIndex] = currentGeneration;
+            visited[cellIndex] = false;
+            distancesFromStart[cellIndex] = std::numeric_limits<int>::max();
+            movesFromPredecessor[cellIndex] = NoMove;
+        }
     }
+
+    void push(const OpenListEntry& entry);
+    OpenListEntry pop();
+
+    std::uint32_t currentGeneration{0};
+    std::vector<std::uint32_t> generations;
+    std::vector<char> visited;
+    std::vector<int> distancesFromStart;
+    /// Index into demo::Move::possibleMoves() of the move leading to a cell from its predecessor
+    std::vector<std::int8_t> movesFromPredecessor;
+    /// Binary min heap of cells to expand
+    std::vector<OpenListEntry> openList;
 };
 
 class AStar {
 public:
-    using AStarMazeAdapter = MazeAdapter<AStarCell>;
-    using Cell = AStarCell;
-    using HeuristicFunction = std::function<int(const AStarCell&)>;
-    using Set = std::priority_queue<AStarCell, std::vector<AStarCell>, AStarCell::CompareCells>;
-
     constexpr static int NoPathFound = std::numeric_limits<int>::max();
 
     explicit AStar(Maze::ConstPtr maze) : maze_{std::move(maze)} {};
 
     /**
-     * @brief Calculates the Manhattan distance between two positions using A*.
+     * @brief Returns the length of the shortest path between two positions.
      *
      * A distance of 1 is the distance between two adjacent positions in the maze.
-     * Will consider walls when calculating the distance.
+     * Will consider walls when calculating the distance. On the first call, the distances between all pairs of cells
+     * are precomputed (see MazeDistanceTable), subsequent calls are table lookups.
      */
     int mazeDistance(const Position& start, const Position& goal) const;
 
@@ -69,34 +93,60 @@ public:
      */
     std::optional<Path> pathToClosestDot(const Position& start) const;
 
+    /**
+     * @brief Replaces the maze, e.g. when dots have been eaten.
+     *
+     * The distance table will only be recomputed if the walls of the new maze differ.
+     */
     void updateMaze(const Maze::ConstPtr& maze) {
         maze_ = maze;
+        if (distanceTable_ && !distanceTable_->hasSameWalls(*maze_)) {
+            distanceTable_.reset();
+        }
     }
 
 private:
-    void expandCell(Set& openSet, AStarMazeAdapter& mazeAdapter, const HeuristicFunction& heuristic) const;
+    /**
+     * @brief Runs A* from the start position until a cell satisfying the goal predicate is about to be expanded.
+     *
+     * Returns the index of that cell or std::nullopt if none is reachable.
+     */
+    template <typename IsGoalT, typename HeuristicT>
+    std::optional<int> search(AStarWorkspace& workspace,
+                              const Position& start,
+                              const IsGoalT& isGoal,
+                              const HeuristicT& heuristic) const;
 
     /**
-     * @brief Create a path by traversing predecessor relationships up to a goal position.
+     * @brief Create a path by traversing predecessor relationships up to a goal cell.
      *
-     * Will expand the path backwards until no more predecessor relationship is available. If the cell at the goal
-     * position does not have a predecessor, the path will be empty.
+     * Will expand the path backwards until no more predecessor relationship is available. If the goal cell does not
+     * have a predecessor, the path will be empty.
      */
-    Path extractPathTo(const AStarMazeAdapter& maze, const Position& goal) const;
+    Path extractPathTo(const AStarWorkspace& workspace, const int& goalIndex) const;
 
     /**
-     * @brief Approximates the distance of a given cell to a goal while considering a shortcut via the tunnel.
+     * @brief Approximates the distance of a given position to a goal while considering a shortcut via the tunnel.
      *
      * Always underestimate the actual distance making it suitable for an A* heuristic
      * The first term is the direct manhattan distance.
      * The second term approximates the distance through the tunnel.
      */
-    double optimisticDistanceToGoal(const Cell& cell, const Position& goal) const {
-        return std::min(cell.manhattanDistance(goal), maze_->width() - cell.manhattanDistance(goal));
+    double optimisticDistanceToGoal(const Position& position, const Position& goal) const {
+        const int manhattanDistance = std::abs(position.x - goal.x) + std::abs(position.y - goal.y);
+        return std::min(manhattanDistance, maze_->width() - manhattanDistance);
+    }
+
+    int cellIndex(const Position& position) const {
+        return position.y * maze_->width() + position.x;
+    }
+    Position cellPosition(const int& cellIndex) const {
+        return {cellIndex % maze_->width(), cellIndex / maze_->width()};
     }
 
     Maze::ConstPtr maze_;
-    mutable util_caching::Cache<std::pair<Position, Position>, int> distanceCache_;
+    /// Built lazily on the first call of mazeDistance(), accessed atomically as const queries may run concurrently
+    mutable MazeDistanceTable::ConstPtr distanceTable_;
 };
 
 } // namespace utils
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include "demo/types.hpp"
+
+namespace utils {
+
+/**
+ * @brief A set of maze cells stored as one bit per cell, packed into 64 bit words row by row.
+ *
+ * Counting the cells of a rectangle or the cells two bitboards have in common boils down to a few masks and popcounts
+ * per row instead of probing every cell individually.
+ */
+class Bitboard {
+public:
+    using Position = demo::Position;
+    using Word = std::uint64_t;
+
+    constexpr static int BitsPerWord = 64;
+
+    Bitboard(const int& width, const int& height)
+            : width_{width}, height_{height}, wordsPerRow_{(width + BitsPerWord - 1) / BitsPerWord},
+              words_(static_cast<std::size_t>(height) * wordsPerRow_, 0) {
+    }
+
+    void set(const Position& position) {
+        words_[wordIndex(position)] |= bit(position);
+    }
+    bool test(const Position& position) const {
+        return (words_[wordIndex(position)] & bit(position)) != 0;
+    }
+    void reset(const Position& position) {
+        words_[wordIndex(position)] &= ~bit(position);
+    }
+    void clear() {
+        std::fill(words_.begin(), words_.end(), 0);
+    }
+
+    bool operator==(const Bitboard& other) const {
+        return width_ == other.width_ && height_ == other.height_ && words_ == other.words_;
+    }
+    bool operator!=(const Bitboard& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Adds the cells set in the other bitboard. Both boards need to have the same size.
+     */
+    Bitboard& operator|=(const Bitboard& other) {
+        for (std::size_t word = 0; word < words_.size(); word++) {
+            words_[word] |= other.words_[word];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief The set cells and their four direct neighbors.
+     *
+     * Neighbors across the board edges wrap around to the opposite edge, like the tunnels of the maze do. Shifting
+     * whole words grows all cells by one step at once.
+     */
+    Bitboard withNeighbors() const {
+        Bitboard result{*this};
+        for (int row = 0; row < height_; row++) {
+            const Word* rowWords = &words_[static_cast<std::size_t>(row) * wordsPerRow_];
+            const Word* rowAbove = &words_[static_cast<std::size_t>((row + height_ - 1) % height_) * wordsPerRow_];
+            const Word* rowBelow = &words_[static_cast<std::size_t>((row + 1) % height_) * wordsPerRow_];
+            Word* resultWords = &result.words_[static_cast<std::size_t>(row) * wordsPerRow_];
+
+            for (int word = 0; word < wordsPerRow_; word++) {
+                Word rightNeighbors = rowWords[word] << 1;
+                if (word > 0) {
+                    rightNeighbors |= rowWords[word - 1] >> (BitsPerWord - 1);
+                }
+                Word leftNeighbors = rowWords[word] >> 1;
+                if (word + 1 < wordsPerRow_) {
+                    leftNeighbors |= rowWords[word + 1] << (BitsPerWord - 1);
+                }
+                resultWords[word] |= rightNeighbors | leftNeighbors | rowAbove[word] | rowBelow[word];
+            }
+
+            if (test({0, row})) {
+                result.set({width_ - 1, row});
+            }
+            if (test({width_ - 1, row})) {
+                result.set({0, row});
+            }
+            // The left shift may have pushed the last column into the unused bits of the row
+            resultWords[wordsPerRow_ - 1] &= bitRange(0, (width_ - 1) % BitsPerWord);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Cells set in this but not in the other bitboard. Both boards need to have the same size.
+     */
+    Bitboard without(const Bitboard& other) const {
+        Bitboard result{*this};
+        for (std::size_t word = 0; word < words_.size(); word++) {
+            result.words_[word] &= ~other.words_[word];
+        }
+        return result;
+    }
+
+    /**
+     * @brief True if all cells set here are also set in the other bitboard. Both boards need to have the same size.
+     */
+    bool isSubsetOf(const Bitboard& other) const {
+        for (std::size_t word = 0; word < words_.size(); word++) {
+            if ((words_[word] & ~other.words_[word]) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Calls the given function with the position of each set cell, in row major order.
+     */
+    template <typename FunctionT>
+    void forEachSetCell(const FunctionT& function) const {
+        for (int row = 0; row < height_; row++) {
+            for (int word = 0; word < wordsPerRow_; word++) {
+                Word remainingBits = words_[static_cast<std::size_t>(row) * wordsPerRow_ + word];
+                while (remainingBits != 0) {
+                    const Word lowestBit = remainingBits & (~remainingBits + 1);
+                    function(Position{word * BitsPerWord + popcount(lowestBit - 1), row});
+                    remainingBits ^= lowestBit;
+                }
+            }
+        }
+    }
+
+    int width() const {
+        return width_;
+    }
+    int height() const {
+        return height_;
+    }
+
+    /**
+     * @brief The total number of set cells.
+     */
+    int count() const {
+        int count{0};
+        for (const Word& word : words_) {
+            count += popcount(word);
+        }
+        return count;
+    }
+
+    /**
+     * @brief The number of set cells within the rectangle spanned by the two corners (inclusive).
+     *
+     * The rectangle is clipped to the board.
+     */
+    int countInRectangle(const Position& minCorner, const Position& maxCorner) const {
+        const int minX = std::max(minCorner.x, 0);
+        const int maxX = std::min(maxCorner.x, width_ - 1);
+        const int minY = std::max(minCorner.y, 0);
+        const int maxY = std::min(maxCorner.y, height_ - 1);
+        if (minX > maxX || minY > maxY) {
+            return 0;
+        }
+
+        const int minWord = minX / BitsPerWord;
+        const int maxWord = maxX / BitsPerWord;
+
+        int count{0};
+        for (int row = minY; row <= maxY; row++) {
+            const Word* rowWords = &words_[static_cast<std::size_t>(row) * wordsPerRow_];
+            for (int word = minWord; word <= maxWord; word++) {
+                const int firstBit = word == minWord ? minX % BitsPerWord : 0;
+                const int lastBit = word == maxWord ? maxX % BitsPerWord : BitsPerWord - 1;
+                count += popcount(rowWords[word] & bitRange(firstBit, lastBit));
+            }
+        }
+        return count;
+    }
+
+private:
+    static int popcount(const Word& word) {
+        return static_cast<int>(std::bitset<BitsPerWord>(word).count());
+    }
+    /// A word with the bits firstBit to lastBit (inclusive) set
+    static Word bitRange(const int& firstBit, const int& lastBit) {
+        const Word upToLastBit = lastBit == BitsPerWord - 1 ? ~Word{0} : (Word{1} << (lastBit + 1)) - 1;
+        return upToLastBit & ~((Word{1} << firstBit) - 1);
+    }
+
+    std::size_t wordIndex(const Position& position) const {
+        return static_cast<std::size_t>(position.y) * wordsPerRow_ + position.x / BitsPerWord;
+    }
+    static Word bit(const Position& position) {
+        return Word{1} << (position.x % BitsPerWord);
+    }
+
+    int width_;
+    int height_;
+    int wordsPerRow_;
+    std::vector<Word> words_;
+};
+
+} // namespace utils
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <vector>
 
 #include "demo/types.hpp"
+#include "utils/bitboard.hpp"
 #include "utils/maze.hpp"
 
 namespace utils {
@@ -12,24 +14,33 @@ using Position = demo::Position;
 using Positions = demo::Positions;
 using TileType = demo::TileType;
 
-struct ClusterCell : public BaseCell {
-    ClusterCell(const Position& position, const TileType& type) : BaseCell(position, type) {};
-
-    bool visited{false};
-};
-
 /**
  * @brief A cluster is defined by a set of points that can be connected by a path which passes through neither walls nor
  * empty space.
  */
 struct Cluster {
-    explicit Cluster(const int& clusterId, const Positions& points)
-            : id(clusterId), dots(points), center{findClusterCenter()} {
+    /**
+     * @brief Creates a cluster from the given dots of a maze with the given size (width, height).
+     */
+    explicit Cluster(const int& clusterId, const Positions& points, const Position& mazeSize)
+            : id(clusterId), dots(points), center{}, cells_{mazeSize.x, mazeSize.y} {
+        for (const auto& dot : dots) {
+            cells_.set(dot);
+            sumX_ += dot.x;
+            sumY_ += dot.y;
+        }
+        center = findClusterCenter();
     }
     bool isInCluster(const Position& target) const {
-        return std::any_of(dots.begin(), dots.end(), [target](Position dot) { return dot == target; });
+        return target.x >= 0 && target.x < cells_.width() && target.y >= 0 && target.y < cells_.height() &&
+               cells_.test(target);
     }
 
+    /**
+     * @brief Removes a dot from the cluster and updates the center accordingly, unless the cluster becomes empty.
+     */
+    void removeDot(const Position& dot);
+
     int id;
     Positions dots;
 
@@ -37,28 +48,78 @@ struct Cluster {
 
 private:
     Position findClusterCenter() const;
+
+    Bitboard cells_;
+    int sumX_{0};
+    int sumY_{0};
 };
 
 /**
  * @brief Search and store all clusters of dots (including power pellets) given the maze state.
+ *
+ * The clusters can be kept up to date incrementally: when dots have been eaten, only the affected clusters are updated
+ * (and split if necessary) instead of searching the whole maze again.
  */
 class DotClusterFinder {
 public:
-    using Cell = ClusterCell;
     using Clusters = std::vector<Cluster>;
-    using ClusterMazeAdapter = MazeAdapter<ClusterCell>;
 
-    explicit DotClusterFinder(Maze::ConstPtr maze) : maze_(std::move(maze)), clusters_{findDotClusters()} {
+    explicit DotClusterFinder(Maze::ConstPtr maze)
+            : maze_(std::move(maze)), clusterIds_(maze_->width() * maze_->height(), NoCluster),
+              clusters_{findDotClusters()} {
     }
-    Clusters clusters() const {
+    /**
+     * @brief The clusters in the order they have been found. Clusters split off by an update follow their origin.
+     */
+    const Clusters& clusters() const {
         return clusters_;
     }
 
+    /**
+     * @brief The id of the cluster containing the given position, std::nullopt if there is none.
+     */
+    std::optional<int> clusterIdAt(const Position& position) const {
+        if (!maze_->isInBounds(position) || clusterIds_[cellIndex(position)] == NoCluster) {
+            return std::nullopt;
+        }
+        return clusterIds_[cellIndex(position)];
+    }
+
+    /**
+     * @brief Updates the clusters to a new state of the maze.
+     *
+     * Only the clusters of removed dots are updated, anything else (e.g. a new level) triggers a full search. Changes
+     * are found by comparing to the previous maze, so mazes must not be modified after being passed in.
+     */
+    void update(Maze::ConstPtr maze);
+
 private:
-    Positions expandDot(const Cell& start, const ClusterMazeAdapter& mazeAdapter) const;
-    Clusters findDotClusters() const;
+    constexpr static int NoCluster = -1;
+
+    int cellIndex(const Position& position) const {
+        return position.y * maze_->width() + position.x;
+    }
+    Position mazeSize() const {
+        return {maze_->width(), maze_->height()};
+    }
+
+    /**
+     * @brief Collects all dots connected to the start, limited to the given set of candidate cells.
+     */
+    Positions expandDot(const Position& start, Bitboard& candidates) const;
+    Clusters findDotClusters();
+
+    /**
+     * @brief Finds the connected components of the dots of a cluster whose dots have been removed.
+     *
+     * Replaces the cluster at the given index by one or more clusters, or removes it if it has no dots left.
+     */
+    void splitCluster(const std::size_t& clusterIndex);
 
     Maze::ConstPtr maze_;
+    /// Cluster id per cell, NoCluster for cells that are no dots
+    std::vector<int> clusterIds_;
+    int nextClusterId_{0};
     Clusters clusters_;
 };
 
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "demo/types.hpp"
+#include "utils/maze.hpp"
+
+namespace utils {
+
+/**
+ * @brief Maze distances from a set of source positions to every cell, computed by a single breadth-first search.
+ *
+ * With a single source, this answers "how far is every cell from here" (e.g. from Pacman), with multiple sources it
+ * answers "how far is every cell from the closest source and which one is it" (e.g. from all ghosts). Cells are visited
+ * in the order of increasing distance which makes queries like "the closest dot" a linear scan that can stop early.
+ *
+ * All positions passed to the distance field are wrapped by Maze::positionConsideringTunnel().
+ */
+class DistanceField {
+public:
+    using Direction = demo::Direction;
+    using Path = demo::Path;
+    using Position = demo::Position;
+    using Positions = demo::Positions;
+    using CellPredicate = std::function<bool(const Position&)>;
+
+    using Ptr = std::shared_ptr<DistanceField>;
+    using ConstPtr = std::shared_ptr<const DistanceField>;
+
+    constexpr static int Unreachable = std::numeric_limits<int>::max();
+
+    /**
+     * @brief Computes the distance field for the given sources. Sources within walls are ignored.
+     */
+    DistanceField(Maze::ConstPtr maze, const Positions& sources);
+
+    /**
+     * @brief Maze distance from the closest source to the given position, Unreachable if there is no path.
+     *
+     * Will throw if the position is a wall.
+     */
+    int distance(const Position& position) const;
+
+    /**
+     * @brief Index (within the sources passed to the constructor) of the source closest to the given position.
+     *
+     * Returns std::nullopt if the position can't be reached from any source. Ties are broken by the source order.
+     */
+    std::optional<std::size_t> closestSource(const Position& position) const;
+
+    /**
+     * @brief The reachable cell closest to the sources for which the predicate holds, std::nullopt if there is none.
+     */
+    std::optional<Position> closestCell(const CellPredicate& predicate) const;
+
+    /**
+     * @brief The shortest path from the closest source to the given goal, std::nullopt if there is none.
+     */
+    std::optional<Path> pathTo(const Position& goal) const;
+
+private:
+    constexpr static int NoSource = -1;
+
+    int cellIndex(const Position& position) const;
+
+    Maze::ConstPtr maze_;
+
+    std::vector<int> distances_;
+    std::vector<int> closestSources_;
+    std::vector<std::optional<Direction>> moveFromPredecessor_;
+    /// The reachable cells ordered by increasing distance
+    Positions visitOrder_;
+};
+
+} // namespace utils
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "demo/types.hpp"
+#include "utils/bitboard.hpp"
+#include "utils/maze.hpp"
+
+namespace utils {
+
+/**
+ * @brief Precomputed shortest maze distances between all pairs of passable cells.
+ *
+ * Since the walls of the maze do not change during a game, the distances can be computed once (by a breadth-first
+ * search from each passable cell, considering the tunnel) and looked up in constant time afterwards. Passable cells are
+ * indexed densely, the distances are stored as 16 bit integers to keep the table compact.
+ */
+class MazeDistanceTable {
+public:
+    using Distance = std::uint16_t;
+    using Position = demo::Position;
+    using Positions = demo::Positions;
+    using Ptr = std::shared_ptr<MazeDistanceTable>;
+    using ConstPtr = std::shared_ptr<const MazeDistanceTable>;
+
+    constexpr static int NoPathFound = std::numeric_limits<int>::max();
+
+    explicit MazeDistanceTable(const Maze& maze);
+
+    /**
+     * @brief Returns the maze distance between two passable positions, NoPathFound if they are not connected.
+     *
+     * Both positions have to be within the maze, i.e. already wrapped by Maze::positionConsideringTunnel().
+     * Will throw if one of the positions is a wall.
+     */
+    int distance(const Position& start, const Position& goal) const;
+
+    /**
+     * @brief True if the table has been computed for a maze with the same walls as the given one.
+     */
+    bool hasSameWalls(const Maze& maze) const {
+        return walls_ == maze.walls();
+    }
+
+    int numPassableCells() const {
+        return numPassableCells_;
+    }
+
+private:
+    constexpr static Distance Unreachable = std::numeric_limits<Distance>::max();
+    constexpr static int NoCell = -1;
+
+    int cellIndex(const Position& position) const {
+        if (position.x < 0 || position.x >= width_ || position.y < 0 || position.y >= height_) {
+            throw std::out_of_range("Position is outside of the maze");
+        }
+        return cellIndices_[position.y * width_ + position.x];
+    }
+
+    void computeDistancesFrom(const int& sourceIndex, const std::vector<std::vector<int>>& neighbors);
+
+    int width_;
+    int height_;
+    Bitboard walls_;
+    int numPassableCells_{0};
+
+    /// Index of each cell within the passable cells (row major), NoCell for walls
+    std::vector<int> cellIndices_;
+    /// Distances from each passable cell (rows) to each passable cell (columns)
+    std::vector<Distance> distances_;
+};
+
+} // namespace utils
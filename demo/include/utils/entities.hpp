@@ -9,17 +9,17 @@ namespace utils {
 struct Ghost {
     void update(const demo::entt::Registry& registry, const demo::entt::Entity& entity);
 
-    demo::Position position;
-    demo::Direction direction;
-    demo::GhostMode mode;
+    demo::Position position{};
+    demo::Direction direction{demo::Direction::LEFT};
+    demo::GhostMode mode{demo::GhostMode::SCATTERING};
     std::optional<int> scaredCountdown;
 };
 
 struct Pacman {
     void update(const demo::entt::Registry& registry, const demo::entt::Entity& entity);
 
-    demo::Position position;
-    demo::Direction direction;
+    demo::Position position{};
+    demo::Direction direction{demo::Direction::LEFT};
 };
 
 struct Entities {
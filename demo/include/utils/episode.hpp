@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "demo/pacman_agent.hpp"
+
+namespace utils {
+
+/**
+ * @brief Percentiles of a set of latency samples in microseconds.
+ */
+struct LatencyPercentiles {
+    static LatencyPercentiles fromSamples(std::vector<double> samples);
+
+    double p50{0.};
+    double p90{0.};
+    double p99{0.};
+    double max{0.};
+};
+
+struct EpisodeParameters {
+    /// Seed for all random decisions of the agent. The game seeds its ghosts itself, so episodes are not reproducible.
+    unsigned int seed{0};
+    /// The episode is aborted after this number of game ticks
+    int maxTicks{20000};
+
+    demo::PacmanAgent::Parameters agent;
+};
+
+struct EpisodeResult {
+    unsigned int seed;
+
+    /// The number of dots and energizers Pacman has eaten
+    int score;
+    /// True if Pacman has eaten all dots and energizers
+    bool won;
+    int ticks;
+
+    /// Agent decisions (i.e. game ticks) per second of wall-clock time
+    double decisionsPerSecond;
+    /// Wall-clock latency of PacmanAgent::getCommand() per cycle
+    LatencyPercentiles getCommandLatency;
+};
+
+/**
+ * @brief Plays a single episode of Pacman headless and as fast as possible.
+ *
+ * The episode ends when the game is over, all dots have been eaten or the tick limit has been reached.
+ */
+EpisodeResult runEpisode(const EpisodeParameters& parameters);
+
+} // namespace utils
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/episode.hpp"
+
+namespace utils {
+
+/**
+ * @brief Aggregated scores and timings of a set of episodes.
+ */
+struct EpisodeStatistics {
+    static EpisodeStatistics fromResults(const std::vector<EpisodeResult>& results);
+
+    int numEpisodes{0};
+
+    double meanScore{0.};
+    double scoreStandardDeviation{0.};
+    int minScore{0};
+    int maxScore{0};
+    double winRate{0.};
+
+    double meanDecisionsPerSecond{0.};
+    /// Per-episode latency percentiles averaged over all episodes, the maximum is the overall maximum
+    LatencyPercentiles getCommandLatency;
+};
+
+/**
+ * @brief Runs independent headless episodes in parallel.
+ *
+ * Each worker thread plays one episode at a time with its own game and PacmanAgent, so there is no shared mutable state
+ * between the workers. If numThreads is zero, all hardware threads are used. The results are returned in the order of
+ * the given episodes.
+ */
+std::vector<EpisodeResult> runEpisodes(const std::vector<EpisodeParameters>& episodes, unsigned int numThreads = 0);
+
+/**
+ * @brief A set of agent parameters to evaluate, labeled with the values of the swept dimensions.
+ */
+struct SweepConfiguration {
+    std::vector<std::pair<std::string, double>> values;
+    demo::PacmanAgent::Parameters parameters;
+};
+
+/**
+ * @brief Creates agent parameter configurations for grid or random search.
+ *
+ * Each dimension consists of a name, the candidate values and a function applying a value to the agent parameters.
+ */
+class ParameterSweep {
+public:
+    using Setter = std::function<void(demo::PacmanAgent::Parameters&, double)>;
+
+    explicit ParameterSweep(demo::PacmanAgent::Parameters baseParameters = {})
+            : baseParameters_{std::move(baseParameters)} {
+    }
+
+    ParameterSweep& addDimension(const std::string& name, const std::vector<double>& values, const Setter& setter) {
+        dimensions_.push_back({name, values, setter});
+        return *this;
+    }
+
+    /**
+     * @brief All combinations of the dimensions' values.
+     */
+    std::vector<SweepConfiguration> grid() const;
+
+    /**
+     * @brief A number of configurations with each value drawn uniformly from the dimension's values.
+     */
+    std::vector<SweepConfiguration> random(const int& numSamples, const unsigned int& seed) const;
+
+private:
+    struct Dimension {
+        std::string name;
+        std::vector<double> values;
+        Setter setter;
+    };
+
+    SweepConfiguration configuration(const std::vector<std::size_t>& valueIndices) const;
+
+    demo::PacmanAgent::Parameters baseParameters_;
+    std::vector<Dimension> dimensions_;
+};
+
+struct SweepResult {
+    SweepConfiguration configuration;
+    EpisodeStatistics statistics;
+};
+
+struct EvaluationParameters {
+    int episodesPerConfiguration{10};
+    /// Episode i of each configuration uses the seed firstSeed + i for the random decisions of the agent
+    unsigned int firstSeed{0};
+    int maxTicks{20000};
+    /// Zero means all hardware threads
+    unsigned int numThreads{0};
+};
+
+/**
+ * @brief Evaluates all configurations in parallel and returns their statistics in the same order.
+ */
+std::vector<SweepResult> evaluate(const std::vector<SweepConfiguration>& configurations,
+                                  const EvaluationParameters& parameters);
+
+} // namespace utils
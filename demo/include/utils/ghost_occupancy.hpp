@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "demo/types.hpp"
+#include "utils/bitboard.hpp"
+#include "utils/maze.hpp"
+
+namespace utils {
+
+/**
+ * @brief The cells the ghosts could occupy within each of the next steps.
+ *
+ * Step 0 holds the current ghost positions, each further step adds every passable cell adjacent to the previous one.
+ * This over-approximates any ghost policy moving at most one cell per step and is stored as one bitboard per step, so
+ * checking whether Pacman's path crosses a ghost boils down to one bit test per path step.
+ *
+ * All positions are wrapped by Maze::positionConsideringTunnel().
+ */
+class GhostOccupancy {
+public:
+    using Path = demo::Path;
+    using Position = demo::Position;
+    using Positions = demo::Positions;
+
+    using Ptr = std::shared_ptr<GhostOccupancy>;
+    using ConstPtr = std::shared_ptr<const GhostOccupancy>;
+
+    /**
+     * @brief Expands the given ghost positions for the given number of steps. Ghosts within walls are ignored.
+     */
+    GhostOccupancy(Maze::ConstPtr maze, const Positions& ghostPositions, const int& horizon);
+
+    int horizon() const {
+        return static_cast<int>(steps_.size()) - 1;
+    }
+
+    /**
+     * @brief True if a ghost could be at the given position after the given number of steps.
+     *
+     * Steps beyond the horizon are answered with the last step.
+     */
+    bool isOccupied(const int& step, const Position& position) const;
+
+    /**
+     * @brief The cells a ghost could occupy after the given number of steps, clamped to the horizon.
+     */
+    const Bitboard& occupiedCells(const int& step) const;
+
+    /**
+     * @brief The first step along the path (starting at the given position) at which a ghost could be at the same cell.
+     *
+     * Only the steps within the horizon are checked. The check stops at the first step into a wall. Returns
+     * std::nullopt if there is no possible collision.
+     */
+    std::optional<int> firstCollision(const Position& start, const Path& path) const;
+
+private:
+    Maze::ConstPtr maze_;
+    std::vector<Bitboard> steps_;
+};
+
+} // namespace utils
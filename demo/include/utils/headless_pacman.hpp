@@ -0,0 +1,54 @@
+#pragma once
+
+#include <pacman/core/game.hpp>
+
+#include "demo/types.hpp"
+
+namespace utils {
+
+/**
+ * @brief Drives the Pacman game without a window, renderer or frame rate limitation.
+ *
+ * This is the headless counterpart to the PacmanWrapper. Each call to progressGame() advances the game logic by one
+ * tick, which allows to evaluate the agent as fast as possible. Since the agent's behaviors depend on time, the
+ * headless game provides a simulated time advancing by the duration of a game tick in real-time mode.
+ */
+class HeadlessPacman {
+public:
+    HeadlessPacman() {
+        game_.init();
+    }
+
+    void progressGame(const demo::Command& command);
+
+    bool quit() const {
+        return quit_;
+    }
+    Game& game() {
+        return game_;
+    }
+    int ticks() const {
+        return ticks_;
+    }
+
+    /**
+     * @brief The simulated time of the current tick.
+     */
+    demo::Time time() const {
+        return startTime_ + ticks_ * tickDuration();
+    }
+
+    /**
+     * @brief The duration of a game tick when playing in real-time (with rendering).
+     */
+    static demo::Duration tickDuration();
+
+private:
+    Game game_;
+    int ticks_{0};
+    bool quit_{false};
+
+    demo::Time startTime_{demo::Clock::now()};
+};
+
+} // namespace utils
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include <pacman/core/maze.hpp>
 
 #include "demo/types.hpp"
+#include "utils/bitboard.hpp"
 
 namespace utils {
 
@@ -29,16 +32,62 @@ class Maze {
 public:
     using MazeState = demo::entt::MazeState;
     using Position = demo::Position;
+    using Positions = demo::Positions;
     using TileType = demo::TileType;
 
     using Ptr = std::shared_ptr<Maze>;
     using ConstPtr = std::shared_ptr<const Maze>;
 
-    explicit Maze(MazeState mazeState) : mazeState_(std::move(mazeState)) {
+    explicit Maze(const MazeState& mazeState)
+            : width_{mazeState.width()}, height_{mazeState.height()},
+              tiles_(static_cast<std::size_t>(width_) * height_, TileType::EMPTY),
+              walls_{std::make_shared<Bitboard>(width_, height_)},
+              dots_{width_, height_}, energizers_{width_, height_}, consumables_{width_, height_} {
+        // Convert the tiles once, so that accessing them later on is a plain array lookup
+        for (int row = 0; row < height_; row++) {
+            for (int column = 0; column < width_; column++) {
+                setTile({column, row}, toTileType(mazeState[{column, row}]));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns a maze matching the given maze state, based on the given previous maze.
+     *
+     * Mazes are immutable snapshots: AStar, the distance fields, the dot clusters and copies of the EnvironmentModel
+     * hold on to the maze they have been derived from. Instead of patching the previous maze, it is copied and only the
+     * tiles that changed (usually a single eaten dot) are written. If nothing changed, the previous maze is returned
+     * itself. The walls are shared between both as long as they don't change. If the size of the maze changed, it is
+     * rebuilt entirely.
+     */
+    static ConstPtr updated(const ConstPtr& previousMaze, const MazeState& mazeState) {
+        if (mazeState.width() != previousMaze->width_ || mazeState.height() != previousMaze->height_) {
+            return std::make_shared<const Maze>(mazeState);
+        }
+
+        std::shared_ptr<Maze> maze;
+        for (int row = 0; row < previousMaze->height_; row++) {
+            for (int column = 0; column < previousMaze->width_; column++) {
+                const TileType type = toTileType(mazeState[{column, row}]);
+                const TileType previousType = previousMaze->at({column, row});
+                if (type == previousType) {
+                    continue;
+                }
+                if (!maze) {
+                    maze = std::make_shared<Maze>(*previousMaze);
+                }
+                if ((type == TileType::WALL || previousType == TileType::WALL) &&
+                    maze->walls_ == previousMaze->walls_) {
+                    maze->walls_ = std::make_shared<Bitboard>(*previousMaze->walls_);
+                }
+                maze->setTile({column, row}, type);
+            }
+        }
+        return maze ? maze : previousMaze;
     }
 
     TileType at(const Position& position) const {
-        return tileTypeMap_.at(mazeState_[{position.x, position.y}]);
+        return tiles_[static_cast<std::size_t>(position.y) * width() + position.x];
     }
 
     TileType operator[](const Position& position) const {
@@ -46,10 +95,10 @@ public:
     }
 
     int width() const {
-        return mazeState_.width();
+        return width_;
     }
     int height() const {
-        return mazeState_.height();
+        return height_;
     }
 
     Position positionConsideringTunnel(const Position& position) const {
@@ -73,15 +122,91 @@ public:
         return isInBounds(position) && !isWall(position);
     }
 
+    const Bitboard& walls() const {
+        return *walls_;
+    }
+    const Bitboard& dots() const {
+        return dots_;
+    }
+    const Bitboard& energizers() const {
+        return energizers_;
+    }
+    /// Dots and energizers
+    const Bitboard& consumables() const {
+        return consumables_;
+    }
+
+    /**
+     * @brief The number of dots within the rectangle spanned by the two corners (inclusive), clipped to the maze.
+     */
+    int dotsInRectangle(const Position& minCorner, const Position& maxCorner) const {
+        return dots_.countInRectangle(minCorner, maxCorner);
+    }
+
+    /**
+     * @brief The number of dots on the given positions. Positions outside of the maze are ignored.
+     *
+     * Each cell is counted once, even if the path passes it multiple times. Paths are short, so dots are tested
+     * directly and duplicates are found by searching the preceding positions, which avoids any allocation.
+     */
+    int dotsAlongPath(const Positions& path) const {
+        int nDots = 0;
+        for (auto position = path.begin(); position != path.end(); ++position) {
+            if (isInBounds(*position) && dots_.test(*position) &&
+                std::find(path.begin(), position, *position) == position) {
+                nDots++;
+            }
+        }
+        return nDots;
+    }
+
 private:
-    MazeState mazeState_;
-    std::map<demo::entt::Tile, demo::TileType> tileTypeMap_{
-        {demo::entt::Tile::empty, TileType::EMPTY},
-        {demo::entt::Tile::dot, TileType::DOT},
-        {demo::entt::Tile::energizer, TileType::ENGERIZER},
-        {demo::entt::Tile::wall, TileType::WALL},
-        {demo::entt::Tile::door, TileType::DOOR},
-    };
+    static TileType toTileType(const demo::entt::Tile& tile) {
+        switch (tile) {
+        case demo::entt::Tile::dot:
+            return TileType::DOT;
+        case demo::entt::Tile::energizer:
+            return TileType::ENGERIZER;
+        case demo::entt::Tile::wall:
+            return TileType::WALL;
+        case demo::entt::Tile::door:
+            return TileType::DOOR;
+        case demo::entt::Tile::empty:
+        default:
+            return TileType::EMPTY;
+        }
+    }
+
+    void setTile(const Position& position, const TileType& type) {
+        const TileType previousType = at(position);
+        tileBitboard(previousType, [&position](Bitboard& bitboard) { bitboard.reset(position); });
+        tileBitboard(type, [&position](Bitboard& bitboard) { bitboard.set(position); });
+        tiles_[static_cast<std::size_t>(position.y) * width_ + position.x] = type;
+    }
+
+    /// Applies the given function to each bitboard the tile type is part of
+    template <typename FunctionT>
+    void tileBitboard(const TileType& type, const FunctionT& function) {
+        if (type == TileType::WALL) {
+            function(*walls_);
+        } else if (type == TileType::DOT) {
+            function(dots_);
+            function(consumables_);
+        } else if (type == TileType::ENGERIZER) {
+            function(energizers_);
+            function(consumables_);
+        }
+    }
+
+    int width_;
+    int height_;
+    std::vector<TileType> tiles_;
+
+    /// Shared with the mazes updated from this one, see updated()
+    std::shared_ptr<Bitboard> walls_;
+    Bitboard dots_;
+    Bitboard energizers_;
+    Bitboard consumables_;
 };
 
 struct BaseCell {
@@ -1,17 +1,58 @@
 #include "utils/astar.hpp"
 
+#include <algorithm>
+#include <memory>
+
 namespace utils {
 
-int AStar::mazeDistance(const Position& start, const Position& goal) const {
-    if (distanceCache_.cached({start, goal})) {
-        return distanceCache_.cached({start, goal}).value();
+namespace {
+/// Each thread reuses its own workspace, so that const queries can run concurrently
+AStarWorkspace& threadWorkspace() {
+    thread_local AStarWorkspace workspace;
+    return workspace;
+}
+} // namespace
+
+void AStarWorkspace::startQuery(const int& numCells) {
+    if (generations.size() != static_cast<std::size_t>(numCells)) {
+        generations.assign(numCells, 0);
+        visited.resize(numCells);
+        distancesFromStart.resize(numCells);
+        movesFromPredecessor.resize(numCells);
+        currentGeneration = 0;
+    }
+
+    currentGeneration++;
+    if (currentGeneration == 0) {
+        // The generation counter wrapped around, make sure no cell appears to be up to date
+        std::fill(generations.begin(), generations.end(), 0);
+        currentGeneration = 1;
     }
+    openList.clear();
+}
 
-    std::optional<Path> path = shortestPath(start, goal);
-    int pathLength = path ? static_cast<int>(path->size()) : NoPathFound;
+void AStarWorkspace::push(const OpenListEntry& entry) {
+    openList.push_back(entry);
+    std::push_heap(openList.begin(), openList.end(), CompareEntries{});
+}
 
-    distanceCache_.cache({start, goal}, pathLength);
-    return pathLength;
+AStarWorkspace::OpenListEntry AStarWorkspace::pop() {
+    std::pop_heap(openList.begin(), openList.end(), CompareEntries{});
+    OpenListEntry entry = openList.back();
+    openList.pop_back();
+    return entry;
+}
+
+int AStar::mazeDistance(const Position& start, const Position& goal) const {
+    // Concurrent first calls might both build the table, which is harmless as both tables are equal
+    MazeDistanceTable::ConstPtr distanceTable = std::atomic_load(&distanceTable_);
+    if (!distanceTable) {
+        distanceTable = std::make_shared<const MazeDistanceTable>(*maze_);
+        std::atomic_store(&distanceTable_, distanceTable);
+    }
+
+    // Same as in shortestPath(), we neglect the "virtual" position outside of the maze within the tunnel.
+    return distanceTable->distance(maze_->positionConsideringTunnel(start), maze_->positionConsideringTunnel(goal));
 }
 
 std::optional<Path> AStar::shortestPath(const Position& start, const Position& goal) const {
@@ -21,30 +62,21 @@ std::optional<Path> AStar::shortestPath(const Position& start, const Position& g
     Position wrappedStart = maze_->positionConsideringTunnel(start);
     Position wrappedGoal = maze_->positionConsideringTunnel(goal);
 
-    AStarMazeAdapter mazeAdapter(maze_);
-    Set openSet;
-
-    Cell& startCell = mazeAdapter.cell(wrappedStart);
-    Cell& goalCell = mazeAdapter.cell(wrappedGoal);
-    if (startCell.type == TileType::WALL || goalCell.type == TileType::WALL) {
+    if (maze_->isWall(wrappedStart) || maze_->isWall(wrappedGoal)) {
         throw std::runtime_error("Can't compute path from/to wall cell");
     }
-    startCell.distanceFromStart = 0;
-    HeuristicFunction heuristic = [this, &wrappedGoal](const Cell& cell) {
-        return optimisticDistanceToGoal(cell, wrappedGoal);
-    };
-    startCell.heuristic = heuristic(startCell);
 
-    openSet.push(startCell);
+    AStarWorkspace& workspace = threadWorkspace();
+    std::optional<int> goalIndex = search(
+        workspace,
+        wrappedStart,
+        [&wrappedGoal](const Position& position) { return position == wrappedGoal; },
+        [this, &wrappedGoal](const Position& position) { return optimisticDistanceToGoal(position, wrappedGoal); });
 
-    while (!openSet.empty()) {
-        if (openSet.top().position == wrappedGoal) {
-            return extractPathTo(mazeAdapter, openSet.top().position);
-        }
-        expandCell(openSet, mazeAdapter, heuristic);
+    if (!goalIndex) {
+        return std::nullopt;
     }
-
-    return std::nullopt;
+    return extractPathTo(workspace, goalIndex.value());
 }
 
 std::optional<Path> AStar::pathToClosestDot(const Position& start) const {
@@ -53,69 +85,83 @@ std::optional<Path> AStar::pathToClosestDot(const Position& start) const {
     // tunnel.
     Position wrappedStart = maze_->positionConsideringTunnel(start);
 
-    AStarMazeAdapter mazeAdapter(maze_);
-    Set openSet;
-
-    Cell& startCell = mazeAdapter.cell(wrappedStart);
-    if (startCell.type == TileType::WALL) {
+    if (maze_->isWall(wrappedStart)) {
         throw std::runtime_error("Can't compute path from wall cell");
     }
-    startCell.distanceFromStart = 0;
-    HeuristicFunction heuristic = [](const Cell&) { return 0; };
-    startCell.heuristic = 0;
 
-    openSet.push(startCell);
-
-    while (!openSet.empty()) {
-        // Unfortunately, the pacman simulation will handle the dot consumption after the move, therefore we need to
-        // explicitly exclude the start position from the search.
-        if (openSet.top().type == TileType::DOT && openSet.top().position != start) {
-            return extractPathTo(mazeAdapter, openSet.top().position);
-        }
-        expandCell(openSet, mazeAdapter, heuristic);
+    // Unfortunately, the pacman simulation will handle the dot consumption after the move, therefore we need to
+    // explicitly exclude the start position from the search.
+    AStarWorkspace& workspace = threadWorkspace();
+    std::optional<int> goalIndex = search(
+        workspace,
+        wrappedStart,
+        [this, &start](const Position& position) { return maze_->isDot(position) && position != start; },
+        [](const Position& /*position*/) { return 0.; });
+
+    if (!goalIndex) {
+        return std::nullopt;
     }
-
-    return std::nullopt;
+    return extractPathTo(workspace, goalIndex.value());
 }
 
-void AStar::expandCell(Set& openSet, AStarMazeAdapter& mazeAdapter, const HeuristicFunction& heuristic) const {
-    Cell current = openSet.top();
-    openSet.pop();
-
-    mazeAdapter.cell(current.position).visited = true;
-
-    for (const auto& move : demo::Move::possibleMoves()) {
-        Position nextPosition = current.position + move.deltaPosition;
-
-        nextPosition = maze_->positionConsideringTunnel(nextPosition);
-
-        if (!maze_->isPassableCell(nextPosition)) {
-            continue;
+template <typename IsGoalT, typename HeuristicT>
+std::optional<int> AStar::search(AStarWorkspace& workspace,
+                                 const Position& start,
+                                 const IsGoalT& isGoal,
+                                 const HeuristicT& heuristic) const {
+    workspace.startQuery(maze_->width() * maze_->height());
+
+    const int startIndex = cellIndex(start);
+    workspace.touch(startIndex);
+    workspace.distancesFromStart[startIndex] = 0;
+    workspace.push({heuristic(start), startIndex});
+
+    while (!workspace.openList.empty()) {
+        const int currentIndex = workspace.openList.front().cellIndex;
+        const Position current = cellPosition(currentIndex);
+        if (isGoal(current)) {
+            return currentIndex;
         }
+        workspace.pop();
 
-        Cell& neighbor = mazeAdapter.cell(nextPosition);
-        if (neighbor.visited) {
+        // Cells can be in the open list multiple times, with their best distance expanded first
+        if (workspace.visited[currentIndex]) {
             continue;
         }
-
-        int newDistance = current.distanceFromStart + 1;
-        if (newDistance < neighbor.distanceFromStart) {
-            neighbor.distanceFromStart = newDistance;
-            neighbor.heuristic = heuristic(neighbor);
-            neighbor.moveFromPredecessor = move;
-            openSet.push(neighbor);
+        workspace.visited[currentIndex] = true;
+
+        const int neighborDistance = workspace.distancesFromStart[currentIndex] + 1;
+        const demo::Moves& moves = demo::Move::possibleMoves();
+        for (std::size_t moveIndex = 0; moveIndex < moves.size(); moveIndex++) {
+            const Position nextPosition = maze_->positionConsideringTunnel(current + moves[moveIndex].deltaPosition);
+            if (!maze_->isPassableCell(nextPosition)) {
+                continue;
+            }
+
+            const int nextIndex = cellIndex(nextPosition);
+            workspace.touch(nextIndex);
+            if (workspace.visited[nextIndex]) {
+                continue;
+            }
+
+            if (neighborDistance < workspace.distancesFromStart[nextIndex]) {
+                workspace.distancesFromStart[nextIndex] = neighborDistance;
+                workspace.movesFromPredecessor[nextIndex] = static_cast<std::int8_t>(moveIndex);
+                workspace.push({neighborDistance + heuristic(nextPosition), nextIndex});
+            }
         }
     }
+
+    return std::nullopt;
 }
 
-Path AStar::extractPathTo(const AStarMazeAdapter& maze, const Position& goal) const {
+Path AStar::extractPathTo(const AStarWorkspace& workspace, const int& goalIndex) const {
     Path path;
-    Cell current = maze.cell(goal);
-    while (current.moveFromPredecessor) {
-        path.push_back(current.moveFromPredecessor->direction);
-        Position predecessorPosition = current.position - current.moveFromPredecessor->deltaPosition;
-        predecessorPosition = maze_->positionConsideringTunnel(predecessorPosition);
-        current = maze.cell(predecessorPosition);
+    int currentIndex = goalIndex;
+    while (workspace.movesFromPredecessor[currentIndex] != AStarWorkspace::NoMove) {
+        const demo::Move& move = demo::Move::possibleMoves()[workspace.movesFromPredecessor[currentIndex]];
+        path.push_back(move.direction);
+        currentIndex = cellIndex(maze_->positionConsideringTunnel(cellPosition(currentIndex) - move.deltaPosition));
     }
 
     std::reverse(path.begin(), path.end());
@@ -3,11 +3,13 @@
 
 namespace demo {
 
-Command AvoidGhostBehavior::getCommand(const Time& time) {
+Command AvoidGhostBehavior::getCommand(const Time& /*time*/) {
     auto pacmanPosition = environmentModel_->pacmanPosition();
-    auto ghostPosition = environmentModel_->closestGhost(time).ghost.position;
+    const auto& distanceFieldFromGhosts = environmentModel_->distanceFieldFromGhosts();
+    const auto& ghostOccupancy = environmentModel_->ghostOccupancy();
 
     std::optional<Direction> direction;
+    bool isSafe = false;
     double maxDistance = -1;
     for (const auto& move : Move::possibleMoves()) {
         auto nextPosition = environmentModel_->positionConsideringTunnel(pacmanPosition + move.deltaPosition);
@@ -16,9 +18,13 @@ Command AvoidGhostBehavior::getCommand(const Time& time) {
             continue;
         }
 
-        auto nextDistance = environmentModel_->mazeDistance(nextPosition, ghostPosition);
-        if (nextDistance > maxDistance) {
+        // Prefer cells no dangerous ghost can reach within the next step, then the largest distance to the closest
+        // ghost as seen from the next position
+        const bool nextIsSafe = !ghostOccupancy.isOccupied(1, nextPosition);
+        auto nextDistance = distanceFieldFromGhosts.distance(nextPosition);
+        if (nextIsSafe > isSafe || (nextIsSafe == isSafe && nextDistance > maxDistance)) {
             direction = move.direction;
+            isSafe = nextIsSafe;
             maxDistance = nextDistance;
         }
     }
@@ -14,7 +14,7 @@ Command ChangeDotClusterBehavior::getCommand(const Time& /*time*/) {
 
 bool ChangeDotClusterBehavior::checkInvocationCondition(const Time& /*time*/) const {
     auto pacmanPosition = environmentModel_->pacmanPosition();
-    Clusters clusters = environmentModel_->dotCluster();
+    const Clusters& clusters = environmentModel_->dotCluster();
 
     if (clusters.empty()) {
         // We cannot navigate to a cluster if there aren't any
@@ -35,7 +35,7 @@ bool ChangeDotClusterBehavior::checkCommitmentCondition(const Time& /*time*/) co
 
 void ChangeDotClusterBehavior::setTargetCluster() {
     auto pacmanPosition = environmentModel_->pacmanPosition();
-    Clusters clusters = environmentModel_->dotCluster();
+    const Clusters& clusters = environmentModel_->dotCluster();
 
     int minDistance = std::numeric_limits<int>::max();
     for (const auto& cluster : clusters) {
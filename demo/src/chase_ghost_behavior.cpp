@@ -6,14 +6,14 @@ namespace demo {
 Command ChaseGhostBehavior::getCommand(const Time& time) {
     auto pacmanPosition = environmentModel_->pacmanPosition();
 
-    auto closestScaredGhost = environmentModel_->closestScaredGhost(time);
-    if (!closestScaredGhost) {
+    if (!environmentModel_->closestScaredGhost(time)) {
         throw std::runtime_error("Can not compute command to chase ghost because there are no scared ghosts.");
     }
-
-    auto ghostPosition = closestScaredGhost->ghost.position;
+    const auto& distanceFieldFromScaredGhosts = environmentModel_->distanceFieldFromScaredGhosts();
+    const auto& ghostOccupancy = environmentModel_->ghostOccupancy();
 
     std::optional<Direction> direction;
+    bool isSafe = false;
     double minDistance = std::numeric_limits<double>::max();
     for (const auto& move : Move::possibleMoves()) {
         auto nextPosition = environmentModel_->positionConsideringTunnel(pacmanPosition + move.deltaPosition);
@@ -22,10 +22,13 @@ Command ChaseGhostBehavior::getCommand(const Time& time) {
             continue;
         }
 
-        // Chose the direction moving pacman towards the closest scared ghost (considering ghost movement)
-        auto nextDistance = environmentModel_->mazeDistance(nextPosition, ghostPosition);
-        if (nextDistance < minDistance) {
+        // Chose the direction moving pacman towards the closest scared ghost (considering ghost movement), but avoid
+        // cells a dangerous ghost could reach within the next step
+        const bool nextIsSafe = !ghostOccupancy.isOccupied(1, nextPosition);
+        auto nextDistance = distanceFieldFromScaredGhosts.distance(nextPosition);
+        if (nextIsSafe > isSafe || (nextIsSafe == isSafe && nextDistance < minDistance)) {
             direction = move.direction;
+            isSafe = nextIsSafe;
             minDistance = nextDistance;
         }
     }
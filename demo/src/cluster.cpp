@@ -1,24 +1,34 @@
 #include "utils/cluster.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <queue>
+#include <stdexcept>
+#include <utility>
 
 namespace utils {
 
+void Cluster::removeDot(const Position& dot) {
+    auto dotIt = std::find(dots.begin(), dots.end(), dot);
+    if (dotIt == dots.end()) {
+        return;
+    }
+    dots.erase(dotIt);
+    cells_.reset(dot);
+    sumX_ -= dot.x;
+    sumY_ -= dot.y;
+
+    if (!dots.empty()) {
+        center = findClusterCenter();
+    }
+}
+
 Position Cluster::findClusterCenter() const {
     if (dots.empty()) {
         throw std::runtime_error("Cannot find center of an empty cluster");
     }
-    int sumX = 0;
-    int sumY = 0;
-
-    for (const auto& point : dots) {
-        sumX += point.x;
-        sumY += point.y;
-    }
 
-    const int avgX = std::floor(sumX / dots.size());
-    const int avgY = std::floor(sumY / dots.size());
+    const int avgX = std::floor(sumX_ / dots.size());
+    const int avgY = std::floor(sumY_ / dots.size());
 
     const Position avgPosition{avgX, avgY};
     auto distanceComparator = [&avgPosition](const Position& lhs, const Position& rhs) {
@@ -29,55 +39,126 @@ Position Cluster::findClusterCenter() const {
     return closestDot;
 }
 
-DotClusterFinder::Clusters DotClusterFinder::findDotClusters() const {
-    ClusterMazeAdapter mazeAdapter(maze_);
-    Clusters clusters;
-    int clusterId = 0;
+void DotClusterFinder::update(Maze::ConstPtr maze) {
+    if (maze == maze_) {
+        return;
+    }
+    const Maze::ConstPtr previousMaze = std::exchange(maze_, std::move(maze));
 
-    for (int row = 0; row < maze_->height(); row++) {
-        for (int column = 0; column < maze_->width(); column++) {
-            Position start{column, row};
-            ClusterCell& startCell = mazeAdapter.cell(start);
+    const Bitboard& consumables = maze_->consumables();
+    const Bitboard& previousConsumables = previousMaze->consumables();
+    const bool sameLayout = previousMaze->walls() == maze_->walls();
 
-            if (!startCell.isConsumable() || startCell.visited) {
-                continue;
+    if (!sameLayout || !consumables.isSubsetOf(previousConsumables)) {
+        // New dots appeared, e.g. because the next level started
+        clusterIds_.assign(maze_->width() * maze_->height(), NoCluster);
+        clusters_ = findDotClusters();
+        return;
+    }
+
+    // Remove the eaten dots from their clusters. Removing a dot with at most one neighbor within the same cluster can't
+    // split the cluster, all others need to be checked by a local search.
+    std::vector<int> clustersToSplit;
+    const Bitboard eatenDots = previousConsumables.without(consumables);
+    eatenDots.forEachSetCell([this, &clustersToSplit](const Position& dot) {
+        const int clusterId = clusterIds_[cellIndex(dot)];
+        if (clusterId == NoCluster) {
+            return;
+        }
+        clusterIds_[cellIndex(dot)] = NoCluster;
+
+        auto cluster = std::find_if(clusters_.begin(), clusters_.end(), [&clusterId](const Cluster& cluster) {
+            return cluster.id == clusterId;
+        });
+        cluster->removeDot(dot);
+
+        int numNeighborsInCluster{0};
+        for (const auto& move : demo::Move::possibleMoves()) {
+            const Position neighbor = maze_->positionConsideringTunnel(dot + move.deltaPosition);
+            if (maze_->isInBounds(neighbor) && clusterIds_[cellIndex(neighbor)] == clusterId) {
+                numNeighborsInCluster++;
             }
-            Positions dots = expandDot(startCell, mazeAdapter);
-            clusters.emplace_back(clusterId++, dots);
         }
+        if (cluster->dots.empty() || numNeighborsInCluster > 1) {
+            clustersToSplit.push_back(clusterId);
+        }
+    });
+
+    std::sort(clustersToSplit.begin(), clustersToSplit.end());
+    clustersToSplit.erase(std::unique(clustersToSplit.begin(), clustersToSplit.end()), clustersToSplit.end());
+    for (const int& clusterId : clustersToSplit) {
+        auto cluster = std::find_if(clusters_.begin(), clusters_.end(), [&clusterId](const Cluster& cluster) {
+            return cluster.id == clusterId;
+        });
+        splitCluster(std::distance(clusters_.begin(), cluster));
     }
-    return clusters;
 }
 
-Positions DotClusterFinder::expandDot(const Cell& start, const ClusterMazeAdapter& mazeAdapter) const {
-    Positions dots;
+DotClusterFinder::Clusters DotClusterFinder::findDotClusters() {
+    Clusters clusters;
 
-    std::queue<Position> explorationQueue;
-    explorationQueue.push(start.position);
+    const Bitboard consumables = maze_->consumables();
+    Bitboard candidates = consumables;
+    consumables.forEachSetCell([this, &clusters, &candidates](const Position& start) {
+        if (!candidates.test(start)) {
+            // Already part of a cluster
+            return;
+        }
+        const int clusterId = nextClusterId_++;
+        Positions dots = expandDot(start, candidates);
+        for (const auto& dot : dots) {
+            clusterIds_[cellIndex(dot)] = clusterId;
+        }
+        clusters.emplace_back(clusterId, dots, mazeSize());
+    });
+    return clusters;
+}
 
-    while (!explorationQueue.empty()) {
-        Position currentPosition = explorationQueue.front();
-        explorationQueue.pop();
-        ClusterCell& current = mazeAdapter.cell(currentPosition);
+void DotClusterFinder::splitCluster(const std::size_t& clusterIndex) {
+    const Cluster cluster = clusters_[clusterIndex];
+    clusters_.erase(clusters_.begin() + clusterIndex);
 
-        if (current.visited) {
-            continue;
+    Bitboard candidates{maze_->width(), maze_->height()};
+    for (const auto& dot : cluster.dots) {
+        candidates.set(dot);
+    }
+    const Bitboard clusterDots = candidates;
+
+    // The first component keeps the id of the original cluster
+    bool isFirstComponent{true};
+    auto insertPosition = clusters_.begin() + clusterIndex;
+    clusterDots.forEachSetCell([&](const Position& start) {
+        if (!candidates.test(start)) {
+            return;
         }
-        current.visited = true;
-        dots.push_back(currentPosition);
+        const int clusterId = isFirstComponent ? cluster.id : nextClusterId_++;
+        isFirstComponent = false;
+
+        Positions dots = expandDot(start, candidates);
+        for (const auto& dot : dots) {
+            clusterIds_[cellIndex(dot)] = clusterId;
+        }
+        insertPosition = clusters_.emplace(insertPosition, clusterId, dots, mazeSize()) + 1;
+    });
+}
+
+Positions DotClusterFinder::expandDot(const Position& start, Bitboard& candidates) const {
+    Positions dots{start};
+    candidates.reset(start);
+
+    // Breadth-first search, the dots double as queue since each dot is added at most once
+    for (std::size_t next = 0; next < dots.size(); next++) {
+        const Position currentPosition = dots[next];
 
         for (const auto& move : demo::Move::possibleMoves()) {
             Position nextPosition = currentPosition + move.deltaPosition;
             nextPosition = maze_->positionConsideringTunnel(nextPosition);
 
-            if (!maze_->isPassableCell(nextPosition)) {
+            if (!maze_->isPassableCell(nextPosition) || !candidates.test(nextPosition)) {
                 continue;
             }
-            ClusterCell& neighbor = mazeAdapter.cell(nextPosition);
-
-            if (neighbor.isConsumable() && !neighbor.visited) {
-                explorationQueue.push(nextPosition);
-            }
+            candidates.reset(nextPosition);
+            dots.push_back(nextPosition);
         }
     }
 
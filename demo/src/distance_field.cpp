@@ -0,0 +1,96 @@
+#include "utils/distance_field.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace utils {
+
+DistanceField::DistanceField(Maze::ConstPtr maze, const Positions& sources)
+        : maze_{std::move(maze)},
+          distances_(maze_->width() * maze_->height(), Unreachable),
+          closestSources_(maze_->width() * maze_->height(), NoSource),
+          moveFromPredecessor_(maze_->width() * maze_->height()) {
+    visitOrder_.reserve(distances_.size());
+
+    for (std::size_t sourceIndex = 0; sourceIndex < sources.size(); sourceIndex++) {
+        const Position source = maze_->positionConsideringTunnel(sources[sourceIndex]);
+        if (!maze_->isPassableCell(source)) {
+            continue;
+        }
+        const int index = source.y * maze_->width() + source.x;
+        if (distances_[index] == Unreachable) {
+            distances_[index] = 0;
+            closestSources_[index] = static_cast<int>(sourceIndex);
+            visitOrder_.push_back(source);
+        }
+    }
+
+    // Breadth-first search, the visit order doubles as queue since each cell is enqueued at most once
+    const demo::Moves& moves = demo::Move::possibleMoves();
+    for (std::size_t next = 0; next < visitOrder_.size(); next++) {
+        const Position current = visitOrder_[next];
+        const int currentIndex = current.y * maze_->width() + current.x;
+
+        for (const auto& move : moves) {
+            const Position nextPosition = maze_->positionConsideringTunnel(current + move.deltaPosition);
+            if (!maze_->isPassableCell(nextPosition)) {
+                continue;
+            }
+
+            const int nextIndex = nextPosition.y * maze_->width() + nextPosition.x;
+            if (distances_[nextIndex] != Unreachable) {
+                continue;
+            }
+            distances_[nextIndex] = distances_[currentIndex] + 1;
+            closestSources_[nextIndex] = closestSources_[currentIndex];
+            moveFromPredecessor_[nextIndex] = move.direction;
+            visitOrder_.push_back(nextPosition);
+        }
+    }
+}
+
+int DistanceField::distance(const Position& position) const {
+    return distances_[cellIndex(position)];
+}
+
+std::optional<std::size_t> DistanceField::closestSource(const Position& position) const {
+    const int closestSource = closestSources_[cellIndex(position)];
+    if (closestSource == NoSource) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(closestSource);
+}
+
+std::optional<DistanceField::Position> DistanceField::closestCell(const CellPredicate& predicate) const {
+    auto closestCell = std::find_if(visitOrder_.begin(), visitOrder_.end(), predicate);
+    if (closestCell == visitOrder_.end()) {
+        return std::nullopt;
+    }
+    return *closestCell;
+}
+
+std::optional<DistanceField::Path> DistanceField::pathTo(const Position& goal) const {
+    Position current = maze_->positionConsideringTunnel(goal);
+    if (distance(current) == Unreachable) {
+        return std::nullopt;
+    }
+
+    Path path;
+    while (const std::optional<Direction>& move = moveFromPredecessor_[cellIndex(current)]) {
+        path.push_back(move.value());
+        current = maze_->positionConsideringTunnel(current - demo::Move(move.value()).deltaPosition);
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+int DistanceField::cellIndex(const Position& position) const {
+    const Position wrappedPosition = maze_->positionConsideringTunnel(position);
+    if (maze_->isWall(wrappedPosition)) {
+        throw std::runtime_error("Can't compute distance from/to wall cell");
+    }
+    return wrappedPosition.y * maze_->width() + wrappedPosition.x;
+}
+
+} // namespace utils
@@ -0,0 +1,72 @@
+#include "utils/distance_table.hpp"
+
+#include <stdexcept>
+
+namespace utils {
+
+MazeDistanceTable::MazeDistanceTable(const Maze& maze)
+        : width_{maze.width()}, height_{maze.height()}, walls_{maze.walls()},
+          cellIndices_(maze.width() * maze.height(), NoCell) {
+    Positions passableCells;
+    for (int row = 0; row < height_; row++) {
+        for (int column = 0; column < width_; column++) {
+            const Position position{column, row};
+            if (maze.isWall(position)) {
+                continue;
+            }
+            cellIndices_[row * width_ + column] = numPassableCells_++;
+            passableCells.push_back(position);
+        }
+    }
+
+    // The neighbors of each passable cell, considering the tunnel
+    std::vector<std::vector<int>> neighbors(numPassableCells_);
+    for (int index = 0; index < numPassableCells_; index++) {
+        for (const auto& move : demo::Move::possibleMoves()) {
+            const Position nextPosition = maze.positionConsideringTunnel(passableCells[index] + move.deltaPosition);
+            if (maze.isPassableCell(nextPosition)) {
+                neighbors[index].push_back(cellIndex(nextPosition));
+            }
+        }
+    }
+
+    distances_.assign(static_cast<std::size_t>(numPassableCells_) * numPassableCells_, Unreachable);
+    for (int sourceIndex = 0; sourceIndex < numPassableCells_; sourceIndex++) {
+        computeDistancesFrom(sourceIndex, neighbors);
+    }
+}
+
+void MazeDistanceTable::computeDistancesFrom(const int& sourceIndex, const std::vector<std::vector<int>>& neighbors) {
+    Distance* distancesFromSource = &distances_[static_cast<std::size_t>(sourceIndex) * numPassableCells_];
+
+    // Breadth-first search, the queue is a plain vector as each cell is enqueued at most once
+    std::vector<int> queue;
+    queue.reserve(numPassableCells_);
+    queue.push_back(sourceIndex);
+    distancesFromSource[sourceIndex] = 0;
+
+    for (std::size_t next = 0; next < queue.size(); next++) {
+        const int current = queue[next];
+        const Distance neighborDistance = distancesFromSource[current] + 1;
+
+        for (const int& neighbor : neighbors[current]) {
+            if (distancesFromSource[neighbor] == Unreachable) {
+                distancesFromSource[neighbor] = neighborDistance;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+}
+
+int MazeDistanceTable::distance(const Position& start, const Position& goal) const {
+    const int startIndex = cellIndex(start);
+    const int goalIndex = cellIndex(goal);
+    if (startIndex == NoCell || goalIndex == NoCell) {
+        throw std::runtime_error("Can't compute distance from/to wall cell");
+    }
+
+    const Distance distance = distances_[static_cast<std::size_t>(startIndex) * numPassableCells_ + goalIndex];
+    return distance == Unreachable ? NoPathFound : distance;
+}
+
+} // namespace utils
@@ -1,5 +1,7 @@
 #include "utils/entities.hpp"
 
+#include <map>
+
 namespace utils {
 
 std::optional<demo::Direction> toDemoDirection(const demo::entt::Direction& enttDirection) {
@@ -2,6 +2,17 @@
 
 namespace demo {
 
+namespace {
+Positions positions(const utils::Entities::Ghosts& ghosts) {
+    Positions positions;
+    positions.reserve(ghosts.size());
+    for (const auto& ghost : ghosts) {
+        positions.push_back(ghost.position);
+    }
+    return positions;
+}
+} // namespace
+
 void EnvironmentModel::updateEntities(const entt::Registry& registry) {
     auto view = registry.view<const entt::Position>();
     for (auto entity : view) {
@@ -24,15 +35,14 @@ EnvironmentModel::GhostWithDistance EnvironmentModel::closestGhost(const Time& t
         return closestGhostCache_.cached(time).value();
     }
 
-    GhostWithDistance currentlyClosestGhost = closestGhost(entities_.ghosts());
+    GhostWithDistance currentlyClosestGhost = closestGhost(ghosts(), distanceFieldFromGhosts());
     closestGhostCache_.cache(time, currentlyClosestGhost);
 
     return currentlyClosestGhost;
 }
 
 std::optional<EnvironmentModel::GhostWithDistance> EnvironmentModel::closestScaredGhost(const Time& time) const {
-    Ghosts scaredGhosts = entities_.scaredGhosts();
-    if (scaredGhosts.empty()) {
+    if (scaredGhosts().empty()) {
         return std::nullopt;
     }
 
@@ -40,26 +50,91 @@ std::optional<EnvironmentModel::GhostWithDistance> EnvironmentModel::closestScar
         return closestScaredGhostCache_.cached(time).value();
     }
 
-    GhostWithDistance currentlyClosestScaredGhost = closestGhost(scaredGhosts);
+    GhostWithDistance currentlyClosestScaredGhost = closestGhost(scaredGhosts(), distanceFieldFromScaredGhosts());
     closestScaredGhostCache_.cache(time, currentlyClosestScaredGhost);
 
     return currentlyClosestScaredGhost;
 }
 
 
-EnvironmentModel::GhostWithDistance EnvironmentModel::closestGhost(const Ghosts& ghosts) const {
-    int minGhostDistance = std::numeric_limits<int>::max();
-    Ghost closestGhost;
+EnvironmentModel::GhostWithDistance EnvironmentModel::closestGhost(const Ghosts& ghosts,
+                                                                  const DistanceField& distanceFieldFromGhosts) const {
+    std::optional<std::size_t> closestGhostIndex = distanceFieldFromGhosts.closestSource(pacmanPosition());
+    if (!closestGhostIndex) {
+        return {Ghost{}, std::numeric_limits<int>::max()};
+    }
+    return {ghosts.at(closestGhostIndex.value()), distanceFieldFromGhosts.distance(pacmanPosition())};
+}
 
-    for (const auto& ghost : ghosts) {
-        int ghostDistance = mazeDistance(pacmanPosition(), ghost.position);
-        if (ghostDistance < minGhostDistance) {
-            minGhostDistance = ghostDistance;
-            closestGhost = ghost;
+const EnvironmentModel::Ghosts& EnvironmentModel::ghosts() const {
+    if (!ghostsUpToDate_) {
+        ghosts_.clear();
+        scaredGhosts_.clear();
+        for (const Ghost* ghost : {&entities_.blinky, &entities_.pinky, &entities_.inky, &entities_.clyde}) {
+            ghosts_.push_back(*ghost);
+            if (ghost->mode == GhostMode::SCARED) {
+                scaredGhosts_.push_back(*ghost);
+            }
         }
+        ghostsUpToDate_ = true;
     }
+    return ghosts_;
+}
+
+const EnvironmentModel::Ghosts& EnvironmentModel::scaredGhosts() const {
+    ghosts();
+    return scaredGhosts_;
+}
 
-    return {closestGhost, minGhostDistance};
+const EnvironmentModel::DistanceField& EnvironmentModel::distanceFieldFromPacman() const {
+    if (!distanceFieldFromPacman_) {
+        distanceFieldFromPacman_ = std::make_shared<const DistanceField>(maze_, Positions{pacmanPosition()});
+    }
+    return *distanceFieldFromPacman_;
+}
+
+const EnvironmentModel::DistanceField& EnvironmentModel::distanceFieldFromGhosts() const {
+    if (!distanceFieldFromGhosts_) {
+        distanceFieldFromGhosts_ = std::make_shared<const DistanceField>(maze_, positions(ghosts()));
+    }
+    return *distanceFieldFromGhosts_;
+}
+
+const EnvironmentModel::DistanceField& EnvironmentModel::distanceFieldFromScaredGhosts() const {
+    if (!distanceFieldFromScaredGhosts_) {
+        distanceFieldFromScaredGhosts_ =
+            std::make_shared<const DistanceField>(maze_, positions(scaredGhosts()));
+    }
+    return *distanceFieldFromScaredGhosts_;
+}
+
+const EnvironmentModel::GhostOccupancy& EnvironmentModel::ghostOccupancy() const {
+    if (!ghostOccupancy_) {
+        Positions dangerousGhostPositions;
+        for (const auto& ghost : ghosts()) {
+            if (ghost.mode == GhostMode::CHASING || ghost.mode == GhostMode::SCATTERING) {
+                dangerousGhostPositions.push_back(ghost.position);
+            }
+        }
+        ghostOccupancy_ =
+            std::make_shared<const GhostOccupancy>(maze_, dangerousGhostPositions, GhostOccupancyHorizon);
+    }
+    return *ghostOccupancy_;
+}
+
+std::optional<Path> EnvironmentModel::pathToClosestDot(const Position& position) const {
+    if (positionConsideringTunnel(position) != positionConsideringTunnel(pacmanPosition())) {
+        return astar_.pathToClosestDot(position);
+    }
+
+    // Unfortunately, the pacman simulation will handle the dot consumption after the move, therefore we need to
+    // explicitly exclude the start position from the search.
+    std::optional<Position> closestDot = distanceFieldFromPacman().closestCell(
+        [this, &position](const Position& cell) { return cell != position && maze_->isDot(cell); });
+    if (!closestDot) {
+        return std::nullopt;
+    }
+    return distanceFieldFromPacman().pathTo(closestDot.value());
 }
 
 Positions EnvironmentModel::toAbsolutePath(const Path& path) const {
@@ -0,0 +1,86 @@
+#include "utils/episode.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "utils/headless_pacman.hpp"
+
+namespace utils {
+
+namespace {
+int countConsumables(const demo::entt::MazeState& maze) {
+    int nConsumables{0};
+    for (int row = 0; row < maze.height(); row++) {
+        for (int column = 0; column < maze.width(); column++) {
+            const demo::entt::Tile tile = maze[{column, row}];
+            if (tile == demo::entt::Tile::dot || tile == demo::entt::Tile::energizer) {
+                nConsumables++;
+            }
+        }
+    }
+    return nConsumables;
+}
+} // namespace
+
+LatencyPercentiles LatencyPercentiles::fromSamples(std::vector<double> samples) {
+    if (samples.empty()) {
+        return {};
+    }
+    std::sort(samples.begin(), samples.end());
+
+    // Nearest-rank percentiles
+    auto percentile = [&samples](const double& fraction) {
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * samples.size()));
+        return samples.at(std::clamp<std::size_t>(rank, 1, samples.size()) - 1);
+    };
+    return {percentile(0.5), percentile(0.9), percentile(0.99), samples.back()};
+}
+
+EpisodeResult runEpisode(const EpisodeParameters& parameters) {
+    using WallClock = std::chrono::steady_clock;
+
+    HeadlessPacman pacman;
+
+    demo::PacmanAgent::Parameters agentParameters = parameters.agent;
+    agentParameters.moveRandomlyBehavior.seed = parameters.seed;
+    demo::PacmanAgent agent(pacman.game(), agentParameters);
+
+    int remainingConsumables = countConsumables(pacman.game().maze);
+    int score{0};
+    bool won{false};
+
+    std::vector<double> getCommandLatencies;
+    getCommandLatencies.reserve(parameters.maxTicks);
+
+    const WallClock::time_point episodeStart = WallClock::now();
+    while (!pacman.quit() && !won && pacman.ticks() < parameters.maxTicks) {
+        agent.updateEnvironmentModel(pacman.game());
+
+        const WallClock::time_point cycleStart = WallClock::now();
+        demo::Command command = agent.getCommand(pacman.time());
+        const std::chrono::duration<double, std::micro> cycleDuration = WallClock::now() - cycleStart;
+        getCommandLatencies.push_back(cycleDuration.count());
+
+        pacman.progressGame(command);
+
+        // The game may already have reset the maze for the next level once the last dot has been eaten
+        const int consumables = countConsumables(pacman.game().maze);
+        won = consumables == 0 || consumables > remainingConsumables;
+        score += won ? remainingConsumables : remainingConsumables - consumables;
+        remainingConsumables = consumables;
+    }
+    const std::chrono::duration<double> episodeDuration = WallClock::now() - episodeStart;
+
+    EpisodeResult result;
+    result.seed = parameters.seed;
+    result.score = score;
+    result.won = won;
+    result.ticks = pacman.ticks();
+    result.decisionsPerSecond =
+        episodeDuration.count() > 0. ? getCommandLatencies.size() / episodeDuration.count() : 0.;
+    result.getCommandLatency = LatencyPercentiles::fromSamples(std::move(getCommandLatencies));
+    return result;
+}
+
+} // namespace utils
@@ -0,0 +1,179 @@
+#include "utils/evaluation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace utils {
+
+EpisodeStatistics EpisodeStatistics::fromResults(const std::vector<EpisodeResult>& results) {
+    EpisodeStatistics statistics;
+    if (results.empty()) {
+        return statistics;
+    }
+    statistics.numEpisodes = static_cast<int>(results.size());
+    statistics.minScore = results.front().score;
+    statistics.maxScore = results.front().score;
+
+    int numWon{0};
+    for (const auto& result : results) {
+        statistics.meanScore += result.score;
+        statistics.minScore = std::min(statistics.minScore, result.score);
+        statistics.maxScore = std::max(statistics.maxScore, result.score);
+        numWon += result.won ? 1 : 0;
+
+        statistics.meanDecisionsPerSecond += result.decisionsPerSecond;
+        statistics.getCommandLatency.p50 += result.getCommandLatency.p50;
+        statistics.getCommandLatency.p90 += result.getCommandLatency.p90;
+        statistics.getCommandLatency.p99 += result.getCommandLatency.p99;
+        statistics.getCommandLatency.max =
+            std::max(statistics.getCommandLatency.max, result.getCommandLatency.max);
+    }
+
+    const double numEpisodes = statistics.numEpisodes;
+    statistics.meanScore /= numEpisodes;
+    statistics.winRate = numWon / numEpisodes;
+    statistics.meanDecisionsPerSecond /= numEpisodes;
+    statistics.getCommandLatency.p50 /= numEpisodes;
+    statistics.getCommandLatency.p90 /= numEpisodes;
+    statistics.getCommandLatency.p99 /= numEpisodes;
+
+    double squaredDeviations{0.};
+    for (const auto& result : results) {
+        squaredDeviations += std::pow(result.score - statistics.meanScore, 2);
+    }
+    statistics.scoreStandardDeviation = std::sqrt(squaredDeviations / numEpisodes);
+
+    return statistics;
+}
+
+std::vector<EpisodeResult> runEpisodes(const std::vector<EpisodeParameters>& episodes, unsigned int numThreads) {
+    if (numThreads == 0) {
+        numThreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min<unsigned int>(numThreads, episodes.size());
+
+    std::vector<EpisodeResult> results(episodes.size());
+
+    // The workers pick the next episode from a shared counter and write to their own result slots only
+    std::atomic<std::size_t> nextEpisode{0};
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        for (std::size_t episode = nextEpisode++; episode < episodes.size(); episode = nextEpisode++) {
+            try {
+                results[episode] = runEpisode(episodes[episode]);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+                nextEpisode = episodes.size();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; i++) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+    return results;
+}
+
+std::vector<SweepConfiguration> ParameterSweep::grid() const {
+    std::vector<SweepConfiguration> configurations;
+    if (std::any_of(dimensions_.begin(), dimensions_.end(), [](const Dimension& dimension) {
+            return dimension.values.empty();
+        })) {
+        return configurations;
+    }
+
+    // Count through all combinations like an odometer, the last dimension changing fastest
+    std::vector<std::size_t> valueIndices(dimensions_.size(), 0);
+    while (true) {
+        configurations.push_back(configuration(valueIndices));
+
+        int dimension = static_cast<int>(dimensions_.size()) - 1;
+        for (; dimension >= 0; dimension--) {
+            if (++valueIndices[dimension] < dimensions_[dimension].values.size()) {
+                break;
+            }
+            valueIndices[dimension] = 0;
+        }
+        if (dimension < 0) {
+            return configurations;
+        }
+    }
+}
+
+std::vector<SweepConfiguration> ParameterSweep::random(const int& numSamples, const unsigned int& seed) const {
+    std::vector<SweepConfiguration> configurations;
+    if (std::any_of(dimensions_.begin(), dimensions_.end(), [](const Dimension& dimension) {
+            return dimension.values.empty();
+        })) {
+        return configurations;
+    }
+
+    std::mt19937 randomGenerator{seed};
+    std::vector<std::size_t> valueIndices(dimensions_.size());
+    for (int sample = 0; sample < numSamples; sample++) {
+        for (std::size_t dimension = 0; dimension < dimensions_.size(); dimension++) {
+            std::uniform_int_distribution<std::size_t> distribution{0, dimensions_[dimension].values.size() - 1};
+            valueIndices[dimension] = distribution(randomGenerator);
+        }
+        configurations.push_back(configuration(valueIndices));
+    }
+    return configurations;
+}
+
+SweepConfiguration ParameterSweep::configuration(const std::vector<std::size_t>& valueIndices) const {
+    SweepConfiguration configuration{{}, baseParameters_};
+    for (std::size_t dimension = 0; dimension < dimensions_.size(); dimension++) {
+        const double value = dimensions_[dimension].values[valueIndices[dimension]];
+        dimensions_[dimension].setter(configuration.parameters, value);
+        configuration.values.emplace_back(dimensions_[dimension].name, value);
+    }
+    return configuration;
+}
+
+std::vector<SweepResult> evaluate(const std::vector<SweepConfiguration>& configurations,
+                                  const EvaluationParameters& parameters) {
+    // Flatten all episodes of all configurations into one job list to keep all workers busy
+    std::vector<EpisodeParameters> episodes;
+    episodes.reserve(configurations.size() * parameters.episodesPerConfiguration);
+    for (const auto& configuration : configurations) {
+        for (int episode = 0; episode < parameters.episodesPerConfiguration; episode++) {
+            EpisodeParameters episodeParameters;
+            episodeParameters.seed = parameters.firstSeed + episode;
+            episodeParameters.maxTicks = parameters.maxTicks;
+            episodeParameters.agent = configuration.parameters;
+            episodes.push_back(episodeParameters);
+        }
+    }
+
+    const std::vector<EpisodeResult> episodeResults = runEpisodes(episodes, parameters.numThreads);
+
+    std::vector<SweepResult> results;
+    results.reserve(configurations.size());
+    for (std::size_t i = 0; i < configurations.size(); i++) {
+        const auto first = episodeResults.begin() + i * parameters.episodesPerConfiguration;
+        const std::vector<EpisodeResult> configurationResults(first, first + parameters.episodesPerConfiguration);
+        results.push_back({configurations[i], EpisodeStatistics::fromResults(configurationResults)});
+    }
+    return results;
+}
+
+} // namespace utils
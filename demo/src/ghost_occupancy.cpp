@@ -0,0 +1,49 @@
+#include "utils/ghost_occupancy.hpp"
+
+#include <algorithm>
+
+namespace utils {
+
+GhostOccupancy::GhostOccupancy(Maze::ConstPtr maze, const Positions& ghostPositions, const int& horizon)
+        : maze_{std::move(maze)} {
+    steps_.reserve(std::max(horizon, 0) + 1);
+
+    Bitboard currentStep{maze_->width(), maze_->height()};
+    for (const auto& ghostPosition : ghostPositions) {
+        const Position position = maze_->positionConsideringTunnel(ghostPosition);
+        if (maze_->isPassableCell(position)) {
+            currentStep.set(position);
+        }
+    }
+    steps_.push_back(currentStep);
+
+    for (int step = 1; step <= horizon; step++) {
+        steps_.push_back(steps_.back().withNeighbors().without(maze_->walls()));
+    }
+}
+
+bool GhostOccupancy::isOccupied(const int& step, const Position& position) const {
+    const Position wrappedPosition = maze_->positionConsideringTunnel(position);
+    return maze_->isPassableCell(wrappedPosition) && occupiedCells(step).test(wrappedPosition);
+}
+
+const Bitboard& GhostOccupancy::occupiedCells(const int& step) const {
+    return steps_[std::clamp(step, 0, horizon())];
+}
+
+std::optional<int> GhostOccupancy::firstCollision(const Position& start, const Path& path) const {
+    Position position = start;
+    const int numSteps = std::min(static_cast<int>(path.size()), horizon());
+    for (int step = 1; step <= numSteps; step++) {
+        position = maze_->positionConsideringTunnel(position + demo::Move{path[step - 1]}.deltaPosition);
+        if (!maze_->isPassableCell(position)) {
+            return std::nullopt;
+        }
+        if (steps_[step].test(position)) {
+            return step;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace utils
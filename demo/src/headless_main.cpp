@@ -0,0 +1,157 @@
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "utils/episode.hpp"
+#include "utils/evaluation.hpp"
+
+using namespace utils;
+
+namespace {
+void printUsage(const char* executable) {
+    std::cout << "Usage: " << executable
+              << " [--episodes N] [--seed SEED] [--max-ticks TICKS] [--threads THREADS]"
+                 " [--sweep grid|random] [--samples SAMPLES]\n"
+              << "\n"
+              << "Plays N episodes of Pacman headless and as fast as possible.\n"
+              << "Episode i seeds the random decisions of the agent with SEED + i, the ghosts are not seeded.\n"
+              << "The episodes are distributed over THREADS worker threads (default: all hardware threads).\n"
+              << "With --sweep, N episodes are played for each agent parameter configuration of a grid search or of\n"
+              << "SAMPLES random configurations (default: 10).\n";
+}
+
+void printLatency(const LatencyPercentiles& latency) {
+    std::cout << "getCommand latency [us] p50 " << latency.p50 << " p90 " << latency.p90 << " p99 " << latency.p99
+              << " max " << latency.max;
+}
+
+ParameterSweep defaultSweep() {
+    ParameterSweep sweep;
+    sweep
+        .addDimension("costEstimator.pathEndNeighborhoodRadius",
+                      {1, 2, 3, 4},
+                      [](demo::PacmanAgent::Parameters& parameters, double value) {
+                          parameters.costEstimator.pathEndNeighborhoodRadius = static_cast<int>(value);
+                      })
+        .addDimension("avoidGhostBehavior.invocationMinDistance",
+                      {3, 5, 7},
+                      [](demo::PacmanAgent::Parameters& parameters, double value) {
+                          parameters.avoidGhostBehavior.invocationMinDistance = value;
+                      })
+        .addDimension("avoidGhostBehavior.commitmentMinDistance",
+                      {5, 7, 9},
+                      [](demo::PacmanAgent::Parameters& parameters, double value) {
+                          parameters.avoidGhostBehavior.commitmentMinDistance = value;
+                      })
+        .addDimension("chaseGhostBehavior.invocationMinDistance",
+                      {3, 5, 7},
+                      [](demo::PacmanAgent::Parameters& parameters, double value) {
+                          parameters.chaseGhostBehavior.invocationMinDistance = value;
+                      });
+    return sweep;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int numEpisodes{10};
+    unsigned int firstSeed{0};
+    int maxTicks{20000};
+    unsigned int numThreads{0};
+    std::string sweepMode;
+    int numSamples{10};
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string argument = argv[i];
+            if (argument == "--help" || argument == "-h") {
+                printUsage(argv[0]);
+                return EXIT_SUCCESS;
+            }
+            if (argument != "--episodes" && argument != "--seed" && argument != "--max-ticks" &&
+                argument != "--threads" && argument != "--sweep" && argument != "--samples") {
+                throw std::invalid_argument("Unknown argument " + argument);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + argument);
+            }
+
+            if (argument == "--episodes") {
+                numEpisodes = std::stoi(argv[++i]);
+            } else if (argument == "--seed") {
+                firstSeed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else if (argument == "--max-ticks") {
+                maxTicks = std::stoi(argv[++i]);
+            } else if (argument == "--threads") {
+                numThreads = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else if (argument == "--sweep") {
+                sweepMode = argv[++i];
+                if (sweepMode != "grid" && sweepMode != "random") {
+                    throw std::invalid_argument("Unknown sweep mode " + sweepMode);
+                }
+            } else {
+                numSamples = std::stoi(argv[++i]);
+            }
+        }
+    } catch (std::exception& e) {
+        std::cout << e.what() << "\n\n";
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        std::cout << std::fixed << std::setprecision(1);
+
+        if (sweepMode.empty()) {
+            std::vector<EpisodeParameters> episodes(numEpisodes);
+            for (int episode = 0; episode < numEpisodes; episode++) {
+                episodes[episode].seed = firstSeed + episode;
+                episodes[episode].maxTicks = maxTicks;
+            }
+            const std::vector<EpisodeResult> results = runEpisodes(episodes, numThreads);
+
+            for (int episode = 0; episode < numEpisodes; episode++) {
+                const EpisodeResult& result = results[episode];
+                std::cout << "episode " << episode << " (seed " << result.seed << "): score " << result.score
+                          << (result.won ? " (won)" : "") << ", " << result.ticks << " ticks, "
+                          << result.decisionsPerSecond << " decisions/s, ";
+                printLatency(result.getCommandLatency);
+                std::cout << '\n';
+            }
+
+            if (numEpisodes > 0) {
+                const EpisodeStatistics statistics = EpisodeStatistics::fromResults(results);
+                std::cout << "mean score " << statistics.meanScore << " (std " << statistics.scoreStandardDeviation
+                          << "), won " << statistics.winRate * 100. << "% of " << statistics.numEpisodes
+                          << " episodes" << std::endl;
+            }
+            return EXIT_SUCCESS;
+        }
+
+        const ParameterSweep sweep = defaultSweep();
+        const std::vector<SweepConfiguration> configurations =
+            sweepMode == "grid" ? sweep.grid() : sweep.random(numSamples, firstSeed);
+        const std::vector<SweepResult> results =
+            evaluate(configurations, EvaluationParameters{numEpisodes, firstSeed, maxTicks, numThreads});
+
+        for (const auto& result : results) {
+            for (const auto& [name, value] : result.configuration.values) {
+                std::cout << name << "=" << value << " ";
+            }
+            const EpisodeStatistics& statistics = result.statistics;
+            std::cout << "| mean score " << statistics.meanScore << " (std " << statistics.scoreStandardDeviation
+                      << ", min " << statistics.minScore << ", max " << statistics.maxScore << "), won "
+                      << statistics.winRate * 100. << "%, " << statistics.meanDecisionsPerSecond << " decisions/s, ";
+            printLatency(statistics.getCommandLatency);
+            std::cout << '\n';
+        }
+    } catch (std::exception& e) {
+        std::cout << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
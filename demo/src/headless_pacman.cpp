@@ -0,0 +1,21 @@
+#include "utils/headless_pacman.hpp"
+
+#include <pacman/core/constants.hpp>
+
+namespace utils {
+
+void HeadlessPacman::progressGame(const demo::Command& command) {
+    game_.input(command.scancode());
+
+    if (!game_.logic()) {
+        quit_ = true;
+    }
+    ticks_++;
+}
+
+demo::Duration HeadlessPacman::tickDuration() {
+    // The PacmanWrapper updates the game logic every tileSize frames
+    return demo::Duration{static_cast<double>(tileSize) / fps};
+}
+
+} // namespace utils
@@ -28,7 +28,8 @@ int main() {
 
             Command command = agent.getCommand(time);
 
-            server.broadcast(agent.yamlString(time));
+            // Only capture and serialize the agent's state if someone is watching
+            server.publish([&agent, &time]() { return agent.yamlString(time); });
 
             demo.progressGame(command, agent.environmentModel());
         }
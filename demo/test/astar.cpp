@@ -1,6 +1,8 @@
 #include "utils/astar.hpp"
 
 #include <ctime>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -148,4 +150,31 @@ TEST_F(AStarTest, pathToClosestDot) {
     ASSERT_EQ(path->size(), 3);
 }
 
+TEST_F(AStarTest, concurrentQueries) {
+    AStar astar(environmentModel_->maze());
+    const std::optional<Path> expectedPath = astar.shortestPath({1, 1}, {8, 8});
+    ASSERT_TRUE(expectedPath.has_value());
+
+    // Const queries of the same instance can run on several threads, e.g. in behaviors evaluated in parallel
+    std::vector<char> pathsMatch(4, false);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < pathsMatch.size(); i++) {
+        threads.emplace_back([&astar, &expectedPath, &pathsMatch, i]() {
+            bool allMatch = true;
+            for (int query = 0; query < 100; query++) {
+                allMatch = allMatch && astar.shortestPath({1, 1}, {8, 8}) == expectedPath &&
+                           astar.mazeDistance({1, 1}, {8, 8}) == 14;
+            }
+            pathsMatch[i] = allMatch;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const char& match : pathsMatch) {
+        EXPECT_TRUE(match);
+    }
+}
+
 } // namespace utils::a_star
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "mock_environment_model.hpp"
+#include "utils/astar.hpp"
+
+namespace utils::a_star {
+
+using namespace demo;
+
+class AStarBenchmark : public ::testing::Test {
+protected:
+    AStarBenchmark() : environmentModel_(std::make_shared<MockEnvironmentModel>()) {
+        const char str[] = {"#####################"
+                            "#.........#.........#"
+                            "#.###.###.#.###.###.#"
+                            "#...................#"
+                            "#.###.#.#####.#.###.#"
+                            "#.....#...#...#.....#"
+                            "#####.### # ###.#####"
+                            "     .#       #.     "
+                            "#####.# ##### #.#####"
+                            "#.........#.........#"
+                            "#.###.###.#.###.###.#"
+                            "#...#...........#...#"
+                            "###.#.#.#####.#.#.###"
+                            "#.....#...#...#.....#"
+                            "#.#######.#.#######.#"
+                            "#...................#"
+                            "#####################"};
+        environmentModel_->setMaze({21, 17}, str);
+
+        const Maze& maze = *environmentModel_->maze();
+        for (int row = 0; row < maze.height(); row++) {
+            for (int column = 0; column < maze.width(); column++) {
+                if (maze.isPassableCell({column, row})) {
+                    passableCells_.push_back({column, row});
+                }
+            }
+        }
+    }
+
+    template <typename QueryT>
+    void measureQueriesPerSecond(const std::string& name, const QueryT& query) {
+        const int numRuns = 20;
+
+        int numQueries = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int run = 0; run < numRuns; run++) {
+            for (std::size_t i = 0; i < passableCells_.size(); i++) {
+                // Pseudo random, but reproducible pairs of positions
+                const Position& from = passableCells_[i];
+                const Position& to = passableCells_[(i * 7919 + run) % passableCells_.size()];
+                ASSERT_TRUE(query(from, to));
+                numQueries++;
+            }
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const double queriesPerSecond = numQueries / elapsed.count();
+        std::cout << std::fixed << std::setprecision(0) << name << ": " << queriesPerSecond << " queries per second ("
+                  << numQueries << " queries)" << std::endl;
+        RecordProperty(name + "_queries_per_second", std::to_string(queriesPerSecond));
+    }
+
+    MockEnvironmentModel::Ptr environmentModel_;
+    Positions passableCells_;
+};
+
+TEST_F(AStarBenchmark, shortestPath) {
+    AStar astar(environmentModel_->maze());
+    measureQueriesPerSecond("shortest_path", [&astar](const Position& from, const Position& to) {
+        return astar.shortestPath(from, to).has_value();
+    });
+}
+
+TEST_F(AStarBenchmark, pathToClosestDot) {
+    AStar astar(environmentModel_->maze());
+    measureQueriesPerSecond("path_to_closest_dot", [&astar](const Position& from, const Position& /*to*/) {
+        return astar.pathToClosestDot(from).has_value();
+    });
+}
+
+TEST_F(AStarBenchmark, mazeDistance) {
+    AStar astar(environmentModel_->maze());
+    measureQueriesPerSecond("maze_distance", [&astar](const Position& from, const Position& to) {
+        return astar.mazeDistance(from, to) != AStar::NoPathFound;
+    });
+}
+
+} // namespace utils::a_star
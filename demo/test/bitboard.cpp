@@ -0,0 +1,90 @@
+#include "utils/bitboard.hpp"
+
+#include <gtest/gtest.h>
+
+namespace utils::a_star {
+
+using namespace demo;
+
+TEST(Bitboard, setAndTest) {
+    Bitboard bitboard(5, 3);
+    EXPECT_EQ(bitboard.count(), 0);
+
+    bitboard.set({0, 0});
+    bitboard.set({4, 2});
+    EXPECT_TRUE(bitboard.test({0, 0}));
+    EXPECT_TRUE(bitboard.test({4, 2}));
+    EXPECT_FALSE(bitboard.test({1, 0}));
+    EXPECT_EQ(bitboard.count(), 2);
+
+    bitboard.clear();
+    EXPECT_EQ(bitboard.count(), 0);
+}
+
+TEST(Bitboard, countInRectangleSpanningMultipleWords) {
+    // Rows wider than a word are split into multiple words
+    Bitboard bitboard(150, 4);
+    for (int x = 0; x < 150; x++) {
+        bitboard.set({x, 1});
+        if (x % 2 == 0) {
+            bitboard.set({x, 2});
+        }
+    }
+
+    EXPECT_EQ(bitboard.count(), 225);
+    EXPECT_EQ(bitboard.countInRectangle({0, 0}, {149, 3}), 225);
+    EXPECT_EQ(bitboard.countInRectangle({60, 1}, {70, 1}), 11);
+    EXPECT_EQ(bitboard.countInRectangle({60, 2}, {129, 2}), 35);
+    EXPECT_EQ(bitboard.countInRectangle({63, 0}, {64, 3}), 3);
+    EXPECT_EQ(bitboard.countInRectangle({140, 0}, {200, 1}), 10);
+    EXPECT_EQ(bitboard.countInRectangle({10, 0}, {5, 3}), 0);
+}
+
+TEST(Bitboard, withNeighbors) {
+    Bitboard bitboard(5, 4);
+    bitboard.set({2, 1});
+    Bitboard grown = bitboard.withNeighbors();
+    EXPECT_EQ(grown.count(), 5);
+    EXPECT_TRUE(grown.test({2, 1}));
+    EXPECT_TRUE(grown.test({1, 1}));
+    EXPECT_TRUE(grown.test({3, 1}));
+    EXPECT_TRUE(grown.test({2, 0}));
+    EXPECT_TRUE(grown.test({2, 2}));
+
+    // Neighbors wrap around the edges
+    bitboard.clear();
+    bitboard.set({0, 0});
+    grown = bitboard.withNeighbors();
+    EXPECT_EQ(grown.count(), 5);
+    EXPECT_TRUE(grown.test({4, 0}));
+    EXPECT_TRUE(grown.test({0, 3}));
+
+    bitboard.clear();
+    bitboard.set({4, 3});
+    grown = bitboard.withNeighbors();
+    EXPECT_EQ(grown.count(), 5);
+    EXPECT_TRUE(grown.test({0, 3}));
+    EXPECT_TRUE(grown.test({4, 0}));
+}
+
+TEST(Bitboard, withNeighborsSpanningMultipleWords) {
+    Bitboard bitboard(130, 3);
+    bitboard.set({63, 1});
+    bitboard.set({128, 1});
+
+    Bitboard grown = bitboard.withNeighbors();
+    EXPECT_EQ(grown.count(), 10);
+    EXPECT_TRUE(grown.test({62, 1}));
+    EXPECT_TRUE(grown.test({64, 1}));
+    EXPECT_TRUE(grown.test({127, 1}));
+    EXPECT_TRUE(grown.test({129, 1}));
+    EXPECT_TRUE(grown.test({128, 0}));
+    EXPECT_FALSE(grown.test({0, 1}));
+
+    Bitboard other(130, 3);
+    other.set({0, 0});
+    grown |= other;
+    EXPECT_EQ(grown.count(), 11);
+}
+
+} // namespace utils::a_star
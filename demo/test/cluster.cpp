@@ -22,6 +22,24 @@ bool clusterExists(const std::vector<Cluster>& clusters, const ExpectedCluster&
         clusters.begin(), clusters.end(), [&](const Cluster& cluster) { return expectedCluster.matches(cluster); });
 }
 
+Positions sortedDots(const Cluster& cluster) {
+    Positions dots = cluster.dots;
+    std::sort(dots.begin(), dots.end(), [](const Position& lhs, const Position& rhs) {
+        return std::make_pair(lhs.y, lhs.x) < std::make_pair(rhs.y, rhs.x);
+    });
+    return dots;
+}
+
+/// Checks that incrementally updated clusters equal the ones found from scratch
+void expectSameClusters(const DotClusterFinder& updated, const DotClusterFinder& rebuilt) {
+    ASSERT_EQ(updated.clusters().size(), rebuilt.clusters().size());
+    for (const auto& cluster : rebuilt.clusters()) {
+        EXPECT_TRUE(std::any_of(updated.clusters().begin(), updated.clusters().end(), [&](const Cluster& other) {
+            return sortedDots(other) == sortedDots(cluster) && other.center == cluster.center;
+        }));
+    }
+}
+
 class ClusterTest : public ::testing::Test {
 protected:
     ClusterTest() : environmentModel_(std::make_shared<MockEnvironmentModel>()) {
@@ -49,4 +67,78 @@ TEST_F(ClusterTest, dotClusters) {
     EXPECT_TRUE(clusterExists(clusters, secondExpectedCluster));
 }
 
+TEST_F(ClusterTest, isInCluster) {
+    const char str[] = {"#####"
+                        "#o..#"
+                        "     "
+                        "#.. #"
+                        "#####"};
+    environmentModel_->setMaze({5, 5}, str);
+
+    DotClusterFinder dotClusterFinder(environmentModel_->maze());
+    ASSERT_TRUE(dotClusterFinder.clusterIdAt({1, 1}));
+    ASSERT_TRUE(dotClusterFinder.clusterIdAt({2, 3}));
+    EXPECT_NE(dotClusterFinder.clusterIdAt({1, 1}), dotClusterFinder.clusterIdAt({2, 3}));
+    EXPECT_FALSE(dotClusterFinder.clusterIdAt({1, 2}));
+    EXPECT_FALSE(dotClusterFinder.clusterIdAt({-1, 2}));
+
+    const Cluster& cluster = dotClusterFinder.clusters().front();
+    EXPECT_TRUE(cluster.isInCluster({3, 1}));
+    EXPECT_FALSE(cluster.isInCluster({1, 3}));
+    EXPECT_FALSE(cluster.isInCluster({7, 1}));
+}
+
+TEST_F(ClusterTest, incrementalUpdate) {
+    const char str[] = {"#######"
+                        "#.....#"
+                        "# ### #"
+                        "#...  #"
+                        "#######"};
+    environmentModel_->setMaze({7, 5}, str);
+    DotClusterFinder dotClusterFinder(environmentModel_->maze());
+    ASSERT_EQ(dotClusterFinder.clusters().size(), 2);
+
+    // Eating a dot at the end of a cluster shrinks it
+    const char strWithoutEnd[] = {"#######"
+                                  "#.... #"
+                                  "# ### #"
+                                  "#...  #"
+                                  "#######"};
+    environmentModel_->setMaze({7, 5}, strWithoutEnd);
+    dotClusterFinder.update(environmentModel_->maze());
+    expectSameClusters(dotClusterFinder, DotClusterFinder(environmentModel_->maze()));
+    EXPECT_TRUE(clusterExists(dotClusterFinder.clusters(), {4, {2, 1}}));
+
+    // Eating a dot in the middle of a cluster splits it
+    const char strSplit[] = {"#######"
+                             "#.. . #"
+                             "# ### #"
+                             "#...  #"
+                             "#######"};
+    environmentModel_->setMaze({7, 5}, strSplit);
+    const int idBeforeSplit = dotClusterFinder.clusterIdAt({1, 1}).value();
+    dotClusterFinder.update(environmentModel_->maze());
+    expectSameClusters(dotClusterFinder, DotClusterFinder(environmentModel_->maze()));
+    EXPECT_EQ(dotClusterFinder.clusters().size(), 3);
+    EXPECT_EQ(dotClusterFinder.clusterIdAt({1, 1}), idBeforeSplit);
+    EXPECT_NE(dotClusterFinder.clusterIdAt({4, 1}), idBeforeSplit);
+    EXPECT_FALSE(dotClusterFinder.clusterIdAt({3, 1}));
+
+    // Eating the last dot of a cluster removes it
+    const char strRemoved[] = {"#######"
+                               "#..   #"
+                               "# ### #"
+                               "#...  #"
+                               "#######"};
+    environmentModel_->setMaze({7, 5}, strRemoved);
+    dotClusterFinder.update(environmentModel_->maze());
+    expectSameClusters(dotClusterFinder, DotClusterFinder(environmentModel_->maze()));
+    EXPECT_EQ(dotClusterFinder.clusters().size(), 2);
+
+    // New dots, e.g. in the next level, require to search all clusters again
+    environmentModel_->setMaze({7, 5}, str);
+    dotClusterFinder.update(environmentModel_->maze());
+    expectSameClusters(dotClusterFinder, DotClusterFinder(environmentModel_->maze()));
+}
+
 } // namespace utils::a_star
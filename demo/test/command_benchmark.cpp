@@ -0,0 +1,80 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "demo/types.hpp"
+
+namespace demo {
+
+class CommandBenchmark : public ::testing::Test {
+protected:
+    template <typename CreateT>
+    void measureCommandsPerSecond(const std::string& name, const CreateT& create) {
+        const int numCommands = 1000000;
+
+        // Accumulate the scancodes so the compiler cannot drop the commands
+        long scancodeSum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < numCommands; i++) {
+            const Direction direction = Move::possibleMoves()[i % 4].direction;
+            const Command command = create(direction);
+            const Command copy = command;
+            scancodeSum += copy.scancode();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        EXPECT_GT(scancodeSum, 0);
+
+        const double commandsPerSecond = numCommands / elapsed.count();
+        std::cout << std::fixed << std::setprecision(0) << name << ": " << commandsPerSecond
+                  << " commands per second (" << numCommands << " commands, each copied once)" << std::endl;
+        RecordProperty(name + "_commands_per_second", std::to_string(commandsPerSecond));
+    }
+};
+
+TEST_F(CommandBenchmark, scancodesAndDeltaPositions) {
+    EXPECT_EQ(Command{Direction::UP}.scancode(), SDL_SCANCODE_UP);
+    EXPECT_EQ(Command{Direction::DOWN}.scancode(), SDL_SCANCODE_DOWN);
+    EXPECT_EQ(Command{Direction::LEFT}.scancode(), SDL_SCANCODE_LEFT);
+    EXPECT_EQ((Command{Path{Direction::RIGHT, Direction::UP}}.scancode()), SDL_SCANCODE_RIGHT);
+
+    static_assert(Move{Direction::UP}.deltaPosition.y == -1);
+    EXPECT_EQ(Move{Direction::UP}.deltaPosition, (Position{0, -1}));
+    EXPECT_EQ(Move{Direction::DOWN}.deltaPosition, (Position{0, 1}));
+    EXPECT_EQ(Move{Direction::LEFT}.deltaPosition, (Position{-1, 0}));
+    EXPECT_EQ(Move{Direction::RIGHT}.deltaPosition, (Position{1, 0}));
+
+    ASSERT_EQ(Move::possibleMoves().size(), 4);
+    EXPECT_EQ(Move::possibleMoves()[2].direction, Direction::LEFT);
+}
+
+TEST_F(CommandBenchmark, singleDirection) {
+    measureCommandsPerSecond("single_direction", [](const Direction& direction) { return Command{direction}; });
+}
+
+TEST_F(CommandBenchmark, path) {
+    measureCommandsPerSecond("path", [](const Direction& direction) {
+        return Command{Path{direction, direction, direction, direction, direction}};
+    });
+}
+
+TEST_F(CommandBenchmark, move) {
+    const int numMoves = 1000000;
+
+    Position position{0, 0};
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numMoves; i++) {
+        const Move move{static_cast<Direction>(i % 4)};
+        position = position + move.deltaPosition;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(position, (Position{0, 0}));
+
+    const double movesPerSecond = numMoves / elapsed.count();
+    std::cout << std::fixed << std::setprecision(0) << "move: " << movesPerSecond << " moves per second" << std::endl;
+    RecordProperty("move_moves_per_second", std::to_string(movesPerSecond));
+}
+
+} // namespace demo
@@ -0,0 +1,121 @@
+#include "utils/distance_field.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock_environment_model.hpp"
+
+namespace utils::a_star {
+
+using namespace demo;
+
+class DistanceFieldTest : public ::testing::Test {
+protected:
+    DistanceFieldTest() : environmentModel_(std::make_shared<MockEnvironmentModel>()) {
+    }
+
+    MockEnvironmentModel::Ptr environmentModel_;
+};
+
+TEST_F(DistanceFieldTest, singleSource) {
+    const char str[] = {"#####"
+                        "#   #"
+                        "# # #"
+                        "#   #"
+                        "#####"};
+    environmentModel_->setMaze({5, 5}, str);
+
+    DistanceField distanceField(environmentModel_->maze(), {{1, 1}});
+    EXPECT_EQ(distanceField.distance({1, 1}), 0);
+    EXPECT_EQ(distanceField.distance({3, 1}), 2);
+    EXPECT_EQ(distanceField.distance({3, 3}), 4);
+    EXPECT_EQ(distanceField.closestSource({3, 3}), 0);
+    EXPECT_THROW(distanceField.distance({2, 2}), std::runtime_error);
+}
+
+TEST_F(DistanceFieldTest, multipleSources) {
+    const char str[] = {"#######"
+                        "#     #"
+                        "#######"};
+    environmentModel_->setMaze({7, 3}, str);
+
+    DistanceField distanceField(environmentModel_->maze(), {{1, 1}, {5, 1}});
+    EXPECT_EQ(distanceField.distance({2, 1}), 1);
+    EXPECT_EQ(distanceField.closestSource({2, 1}), 0);
+    EXPECT_EQ(distanceField.distance({4, 1}), 1);
+    EXPECT_EQ(distanceField.closestSource({4, 1}), 1);
+
+    // Ties are broken by the order of the sources
+    EXPECT_EQ(distanceField.distance({3, 1}), 2);
+    EXPECT_EQ(distanceField.closestSource({3, 1}), 0);
+}
+
+TEST_F(DistanceFieldTest, unreachable) {
+    const char str[] = {"#####"
+                        "# # #"
+                        "#####"};
+    environmentModel_->setMaze({5, 3}, str);
+
+    DistanceField distanceField(environmentModel_->maze(), {{1, 1}});
+    EXPECT_EQ(distanceField.distance({3, 1}), DistanceField::Unreachable);
+    EXPECT_FALSE(distanceField.closestSource({3, 1}));
+    EXPECT_FALSE(distanceField.pathTo({3, 1}));
+}
+
+TEST_F(DistanceFieldTest, tunnel) {
+    const char str[] = {"#####"
+                        "#   #"
+                        "     "
+                        "#   #"
+                        "#####"};
+    environmentModel_->setMaze({5, 5}, str);
+
+    DistanceField distanceField(environmentModel_->maze(), {{0, 2}});
+    EXPECT_EQ(distanceField.distance({4, 2}), 1);
+    EXPECT_EQ(distanceField.distance({3, 1}), 3);
+
+    // Positions outside of the maze are wrapped
+    EXPECT_EQ(distanceField.distance({-1, 2}), 1);
+
+    std::optional<Path> path = distanceField.pathTo({3, 1});
+    ASSERT_TRUE(path.has_value());
+    Path targetPath = {Direction::LEFT, Direction::LEFT, Direction::UP};
+    EXPECT_EQ(path.value(), targetPath);
+}
+
+TEST_F(DistanceFieldTest, pathToClosestDot) {
+    const char str[] = {"#####"
+                        "#  .#"
+                        "# ###"
+                        "#   #"
+                        "#  .#"
+                        "#####"};
+    environmentModel_->setMaze({5, 6}, str);
+    environmentModel_->setPacmanPosition({1, 2});
+
+    std::optional<Path> path = environmentModel_->pathToClosestDot(environmentModel_->pacmanPosition());
+    ASSERT_TRUE(path.has_value());
+    Path targetPath = {Direction::UP, Direction::RIGHT, Direction::RIGHT};
+    EXPECT_EQ(path.value(), targetPath);
+}
+
+TEST_F(DistanceFieldTest, closestGhost) {
+    const char str[] = {"#######"
+                        "#     #"
+                        "# ### #"
+                        "#     #"
+                        "#######"};
+    environmentModel_->setMaze({7, 5}, str);
+    environmentModel_->setPacmanPosition({1, 1});
+    environmentModel_->setGhostPositions({5, 3});
+
+    Entities entities = environmentModel_->entities();
+    entities.inky.position = {1, 3};
+    environmentModel_->setEntities(entities);
+
+    EnvironmentModel::GhostWithDistance closestGhost = environmentModel_->closestGhost(Clock::now());
+    EXPECT_EQ(closestGhost.ghost.position, (Position{1, 3}));
+    EXPECT_EQ(closestGhost.distance, 2);
+    EXPECT_EQ(environmentModel_->distanceFieldFromGhosts().distance({5, 1}), 2);
+}
+
+} // namespace utils::a_star
@@ -0,0 +1,122 @@
+#include "utils/distance_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock_environment_model.hpp"
+#include "utils/astar.hpp"
+
+namespace utils::a_star {
+
+using namespace demo;
+
+class MazeDistanceTableTest : public ::testing::Test {
+protected:
+    MazeDistanceTableTest() : environmentModel_(std::make_shared<MockEnvironmentModel>()) {
+    }
+
+    /// Compares the table distances with the A* path lengths for all pairs of passable cells
+    void expectDistancesMatchShortestPaths(const Maze& maze, const MazeDistanceTable& table) const {
+        AStar astar(environmentModel_->maze());
+        for (int startY = 0; startY < maze.height(); startY++) {
+            for (int startX = 0; startX < maze.width(); startX++) {
+                for (int goalY = 0; goalY < maze.height(); goalY++) {
+                    for (int goalX = 0; goalX < maze.width(); goalX++) {
+                        const Position start{startX, startY};
+                        const Position goal{goalX, goalY};
+                        if (maze.isWall(start) || maze.isWall(goal)) {
+                            continue;
+                        }
+                        std::optional<Path> path = astar.shortestPath(start, goal);
+                        int expectedDistance = path ? static_cast<int>(path->size()) : MazeDistanceTable::NoPathFound;
+                        EXPECT_EQ(table.distance(start, goal), expectedDistance);
+                    }
+                }
+            }
+        }
+    }
+
+    MockEnvironmentModel::Ptr environmentModel_;
+};
+
+TEST_F(MazeDistanceTableTest, matchesShortestPaths) {
+    const char str[] = {"#######"
+                        "#     #"
+                        "# # # #"
+                        "#   # #"
+                        "### # #"
+                        "#     #"
+                        "#######"};
+    environmentModel_->setMaze({7, 7}, str);
+    const Maze& maze = *environmentModel_->maze();
+
+    MazeDistanceTable table(maze);
+    EXPECT_EQ(table.numPassableCells(), 19);
+    expectDistancesMatchShortestPaths(maze, table);
+}
+
+TEST_F(MazeDistanceTableTest, matchesShortestPathsWithTunnel) {
+    const char str[] = {"#######"
+                        "#     #"
+                        "  # #  "
+                        "#   # #"
+                        "#######"};
+    environmentModel_->setMaze({7, 5}, str);
+    const Maze& maze = *environmentModel_->maze();
+
+    MazeDistanceTable table(maze);
+    EXPECT_EQ(table.distance({0, 2}, {6, 2}), 1);
+    EXPECT_EQ(table.distance({5, 1}, {0, 2}), 3);
+    expectDistancesMatchShortestPaths(maze, table);
+}
+
+TEST_F(MazeDistanceTableTest, verticalTunnel) {
+    const char str[] = {"### ###"
+                        "#     #"
+                        "# # # #"
+                        "#     #"
+                        "### ###"};
+    environmentModel_->setMaze({7, 5}, str);
+
+    // The A* heuristic only accounts for horizontal tunnels, the breadth-first search is exact in any case
+    MazeDistanceTable table(*environmentModel_->maze());
+    EXPECT_EQ(table.distance({3, 0}, {3, 4}), 1);
+    EXPECT_EQ(table.distance({3, 1}, {3, 3}), 2);
+    EXPECT_EQ(table.distance({1, 1}, {3, 4}), 4);
+}
+
+TEST_F(MazeDistanceTableTest, unreachableAndWalls) {
+    const char str[] = {"#####"
+                        "# # #"
+                        "#####"};
+    environmentModel_->setMaze({5, 3}, str);
+    const Maze& maze = *environmentModel_->maze();
+
+    MazeDistanceTable table(maze);
+    EXPECT_EQ(table.distance({1, 1}, {1, 1}), 0);
+    EXPECT_EQ(table.distance({1, 1}, {3, 1}), MazeDistanceTable::NoPathFound);
+    EXPECT_THROW(table.distance({0, 0}, {1, 1}), std::runtime_error);
+}
+
+TEST_F(MazeDistanceTableTest, sameWalls) {
+    const char str[] = {"#####"
+                        "#.. #"
+                        "#####"};
+    environmentModel_->setMaze({5, 3}, str);
+    MazeDistanceTable table(*environmentModel_->maze());
+
+    // Eating dots does not change the walls...
+    const char strWithoutDots[] = {"#####"
+                                   "#   #"
+                                   "#####"};
+    environmentModel_->setMaze({5, 3}, strWithoutDots);
+    EXPECT_TRUE(table.hasSameWalls(*environmentModel_->maze()));
+
+    // ...but adding a wall does
+    const char strWithWall[] = {"#####"
+                                "# # #"
+                                "#####"};
+    environmentModel_->setMaze({5, 3}, strWithWall);
+    EXPECT_FALSE(table.hasSameWalls(*environmentModel_->maze()));
+}
+
+} // namespace utils::a_star
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "demo/environment_model.hpp"
+#include "utils/cluster.hpp"
+#include "utils/maze.hpp"
+
+namespace demo {
+
+class EnvironmentModelBenchmark : public ::testing::Test {
+protected:
+    EnvironmentModelBenchmark() {
+        resetMaze();
+        for (int row = 0; row < game_.maze.height(); row++) {
+            for (int column = 0; column < game_.maze.width(); column++) {
+                if (game_.maze[{column, row}] == entt::Tile::dot) {
+                    dots_.push_back({column, row});
+                }
+            }
+        }
+    }
+
+    void resetMaze() {
+        const char str[] = {"#####################"
+                            "#.........#.........#"
+                            "#.###.###.#.###.###.#"
+                            "#o.................o#"
+                            "#.###.#.#####.#.###.#"
+                            "#.....#...#...#.....#"
+                            "#####.### # ###.#####"
+                            "     .#       #.     "
+                            "#####.# ##### #.#####"
+                            "#.........#.........#"
+                            "#.###.###.#.###.###.#"
+                            "#o..#...........#..o#"
+                            "###.#.#.#####.#.#.###"
+                            "#.....#...#...#.....#"
+                            "#.#######.#.#######.#"
+                            "#...................#"
+                            "#####################"};
+        game_.maze = makeCustomMazeState({21, 17}, str);
+    }
+
+    /// Eats the dots one by one and measures the average time of the given update function per tick
+    template <typename UpdateT>
+    double measureMicrosecondsPerTick(const UpdateT& update) {
+        const int numRuns = 20;
+
+        std::chrono::duration<double, std::micro> elapsed{0};
+        for (int run = 0; run < numRuns; run++) {
+            resetMaze();
+            update();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto& dot : dots_) {
+                game_.maze[{dot.x, dot.y}] = entt::Tile::empty;
+                update();
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+        return elapsed.count() / (numRuns * dots_.size());
+    }
+
+    void report(const std::string& name, const double& microsecondsPerTick) {
+        std::cout << std::fixed << std::setprecision(3) << name << ": " << microsecondsPerTick << " us per tick ("
+                  << dots_.size() << " dots)" << std::endl;
+        RecordProperty(name + "_microseconds_per_tick", std::to_string(microsecondsPerTick));
+    }
+
+    entt::Game game_;
+    Positions dots_;
+};
+
+TEST_F(EnvironmentModelBenchmark, update) {
+    EnvironmentModel environmentModel(game_);
+
+    const double microsecondsPerTick = measureMicrosecondsPerTick([&]() { environmentModel.update(game_); });
+    report("snapshot_update", microsecondsPerTick);
+
+    // Only the energizers remain, each of them in a cluster of its own
+    EXPECT_FALSE(environmentModel.isDot(dots_.back()));
+    EXPECT_EQ(environmentModel.dotCluster().size(), 4);
+}
+
+TEST_F(EnvironmentModelBenchmark, rebuild) {
+    // The reference: reconstructing the maze and the dot clusters on every tick
+    std::size_t numClusters{0};
+    const double microsecondsPerTick = measureMicrosecondsPerTick([&]() {
+        auto maze = std::make_shared<utils::Maze>(game_.maze);
+        utils::DotClusterFinder clusterFinder(maze);
+        numClusters = clusterFinder.clusters().size();
+    });
+    report("rebuild", microsecondsPerTick);
+    EXPECT_EQ(numClusters, 4);
+}
+
+} // namespace demo
@@ -0,0 +1,37 @@
+#include "utils/episode.hpp"
+
+#include <gtest/gtest.h>
+
+namespace utils::a_star {
+
+TEST(Episode, latencyPercentiles) {
+    std::vector<double> samples;
+    for (int i = 100; i > 0; i--) {
+        samples.push_back(i);
+    }
+
+    LatencyPercentiles percentiles = LatencyPercentiles::fromSamples(samples);
+    EXPECT_DOUBLE_EQ(percentiles.p50, 50.);
+    EXPECT_DOUBLE_EQ(percentiles.p90, 90.);
+    EXPECT_DOUBLE_EQ(percentiles.p99, 99.);
+    EXPECT_DOUBLE_EQ(percentiles.max, 100.);
+
+    percentiles = LatencyPercentiles::fromSamples({});
+    EXPECT_DOUBLE_EQ(percentiles.max, 0.);
+}
+
+TEST(Episode, runEpisode) {
+    EpisodeParameters parameters;
+    parameters.seed = 42;
+    parameters.maxTicks = 100;
+
+    EpisodeResult result = runEpisode(parameters);
+    EXPECT_EQ(result.seed, 42);
+    EXPECT_GT(result.ticks, 0);
+    EXPECT_LE(result.ticks, parameters.maxTicks);
+    EXPECT_GE(result.score, 0);
+    EXPECT_GT(result.decisionsPerSecond, 0.);
+    EXPECT_LE(result.getCommandLatency.p50, result.getCommandLatency.max);
+}
+
+} // namespace utils::a_star
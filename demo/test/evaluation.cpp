@@ -0,0 +1,124 @@
+#include "utils/evaluation.hpp"
+
+#include <gtest/gtest.h>
+
+namespace utils::a_star {
+
+namespace {
+ParameterSweep testSweep() {
+    ParameterSweep sweep;
+    sweep
+        .addDimension("radius",
+                      {1, 2, 3},
+                      [](demo::PacmanAgent::Parameters& parameters, double value) {
+                          parameters.costEstimator.pathEndNeighborhoodRadius = static_cast<int>(value);
+                      })
+        .addDimension("invocationMinDistance", {4, 6}, [](demo::PacmanAgent::Parameters& parameters, double value) {
+            parameters.avoidGhostBehavior.invocationMinDistance = value;
+        });
+    return sweep;
+}
+} // namespace
+
+TEST(Evaluation, statistics) {
+    std::vector<EpisodeResult> results(2);
+    results[0].score = 10;
+    results[0].won = true;
+    results[0].decisionsPerSecond = 100.;
+    results[0].getCommandLatency = {1., 2., 3., 4.};
+    results[1].score = 20;
+    results[1].won = false;
+    results[1].decisionsPerSecond = 200.;
+    results[1].getCommandLatency = {3., 4., 5., 10.};
+
+    EpisodeStatistics statistics = EpisodeStatistics::fromResults(results);
+    EXPECT_EQ(statistics.numEpisodes, 2);
+    EXPECT_DOUBLE_EQ(statistics.meanScore, 15.);
+    EXPECT_DOUBLE_EQ(statistics.scoreStandardDeviation, 5.);
+    EXPECT_EQ(statistics.minScore, 10);
+    EXPECT_EQ(statistics.maxScore, 20);
+    EXPECT_DOUBLE_EQ(statistics.winRate, 0.5);
+    EXPECT_DOUBLE_EQ(statistics.meanDecisionsPerSecond, 150.);
+    EXPECT_DOUBLE_EQ(statistics.getCommandLatency.p50, 2.);
+    EXPECT_DOUBLE_EQ(statistics.getCommandLatency.p99, 4.);
+    EXPECT_DOUBLE_EQ(statistics.getCommandLatency.max, 10.);
+
+    statistics = EpisodeStatistics::fromResults({});
+    EXPECT_EQ(statistics.numEpisodes, 0);
+}
+
+TEST(Evaluation, gridSweep) {
+    std::vector<SweepConfiguration> configurations = testSweep().grid();
+    ASSERT_EQ(configurations.size(), 6);
+
+    // The last dimension changes fastest
+    EXPECT_EQ(configurations[0].parameters.costEstimator.pathEndNeighborhoodRadius, 1);
+    EXPECT_DOUBLE_EQ(configurations[0].parameters.avoidGhostBehavior.invocationMinDistance, 4.);
+    EXPECT_EQ(configurations[1].parameters.costEstimator.pathEndNeighborhoodRadius, 1);
+    EXPECT_DOUBLE_EQ(configurations[1].parameters.avoidGhostBehavior.invocationMinDistance, 6.);
+    EXPECT_EQ(configurations[5].parameters.costEstimator.pathEndNeighborhoodRadius, 3);
+    EXPECT_DOUBLE_EQ(configurations[5].parameters.avoidGhostBehavior.invocationMinDistance, 6.);
+
+    ASSERT_EQ(configurations[5].values.size(), 2);
+    EXPECT_EQ(configurations[5].values[0].first, "radius");
+    EXPECT_DOUBLE_EQ(configurations[5].values[0].second, 3.);
+
+    // Parameters that are not swept keep their base values
+    EXPECT_DOUBLE_EQ(configurations[0].parameters.avoidGhostBehavior.commitmentMinDistance,
+                     demo::PacmanAgent::Parameters{}.avoidGhostBehavior.commitmentMinDistance);
+
+    EXPECT_EQ(ParameterSweep{}.grid().size(), 1);
+}
+
+TEST(Evaluation, randomSweep) {
+    const ParameterSweep sweep = testSweep();
+    std::vector<SweepConfiguration> configurations = sweep.random(20, 42);
+    ASSERT_EQ(configurations.size(), 20);
+
+    for (const auto& configuration : configurations) {
+        const int radius = configuration.parameters.costEstimator.pathEndNeighborhoodRadius;
+        EXPECT_GE(radius, 1);
+        EXPECT_LE(radius, 3);
+        EXPECT_DOUBLE_EQ(configuration.values[0].second, radius);
+    }
+
+    // The same seed yields the same samples
+    std::vector<SweepConfiguration> otherConfigurations = sweep.random(20, 42);
+    for (std::size_t i = 0; i < configurations.size(); i++) {
+        EXPECT_EQ(configurations[i].values, otherConfigurations[i].values);
+    }
+}
+
+TEST(Evaluation, runEpisodes) {
+    std::vector<EpisodeParameters> episodes(4);
+    for (unsigned int i = 0; i < episodes.size(); i++) {
+        episodes[i].seed = 10 + i;
+        episodes[i].maxTicks = 50;
+    }
+
+    std::vector<EpisodeResult> results = runEpisodes(episodes, 2);
+    ASSERT_EQ(results.size(), episodes.size());
+    for (std::size_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i].seed, episodes[i].seed);
+        EXPECT_LE(results[i].ticks, episodes[i].maxTicks);
+    }
+
+    EXPECT_TRUE(runEpisodes({}).empty());
+}
+
+TEST(Evaluation, evaluate) {
+    std::vector<SweepConfiguration> configurations =
+        ParameterSweep{}
+            .addDimension("commitmentMinDistance",
+                          {7, 8},
+                          [](demo::PacmanAgent::Parameters& parameters, double value) {
+                              parameters.avoidGhostBehavior.commitmentMinDistance = value;
+                          })
+            .grid();
+    std::vector<SweepResult> results = evaluate(configurations, EvaluationParameters{3, 0, 50, 0});
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].statistics.numEpisodes, 3);
+    EXPECT_EQ(results[1].configuration.values, configurations[1].values);
+}
+
+} // namespace utils::a_star
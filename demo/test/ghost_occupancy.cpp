@@ -0,0 +1,91 @@
+#include "utils/ghost_occupancy.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock_environment_model.hpp"
+
+namespace utils::a_star {
+
+using namespace demo;
+
+class GhostOccupancyTest : public ::testing::Test {
+protected:
+    GhostOccupancyTest() : environmentModel_(std::make_shared<MockEnvironmentModel>()) {
+        const char str[] = {"#######"
+                            "#     #"
+                            "# ### #"
+                            "       "
+                            "#######"};
+        environmentModel_->setMaze({7, 5}, str);
+    }
+
+    MockEnvironmentModel::Ptr environmentModel_;
+};
+
+TEST_F(GhostOccupancyTest, growsByOneCellPerStep) {
+    GhostOccupancy occupancy(environmentModel_->maze(), {{1, 1}}, 3);
+    ASSERT_EQ(occupancy.horizon(), 3);
+
+    EXPECT_EQ(occupancy.occupiedCells(0).count(), 1);
+    EXPECT_TRUE(occupancy.isOccupied(0, {1, 1}));
+    EXPECT_FALSE(occupancy.isOccupied(0, {2, 1}));
+
+    EXPECT_EQ(occupancy.occupiedCells(1).count(), 3);
+    EXPECT_TRUE(occupancy.isOccupied(1, {2, 1}));
+    EXPECT_TRUE(occupancy.isOccupied(1, {1, 2}));
+    EXPECT_FALSE(occupancy.isOccupied(1, {1, 3}));
+
+    EXPECT_TRUE(occupancy.isOccupied(2, {1, 3}));
+    EXPECT_TRUE(occupancy.isOccupied(3, {0, 3}));
+
+    // Walls are never occupied, steps beyond the horizon are clamped
+    EXPECT_FALSE(occupancy.isOccupied(3, {2, 2}));
+    EXPECT_EQ(occupancy.occupiedCells(10).count(), occupancy.occupiedCells(3).count());
+}
+
+TEST_F(GhostOccupancyTest, matchesDistanceField) {
+    const Positions ghosts{{5, 1}, {0, 3}};
+    const int horizon = 8;
+    GhostOccupancy occupancy(environmentModel_->maze(), ghosts, horizon);
+    DistanceField distanceField(environmentModel_->maze(), ghosts);
+
+    const Maze& maze = *environmentModel_->maze();
+    for (int step = 0; step <= horizon; step++) {
+        for (int row = 0; row < maze.height(); row++) {
+            for (int column = 0; column < maze.width(); column++) {
+                if (!maze.isPassableCell({column, row})) {
+                    continue;
+                }
+                EXPECT_EQ(occupancy.isOccupied(step, {column, row}), distanceField.distance({column, row}) <= step)
+                    << "step " << step << ", cell " << column << ", " << row;
+            }
+        }
+    }
+}
+
+TEST_F(GhostOccupancyTest, wrapsThroughTunnel) {
+    GhostOccupancy occupancy(environmentModel_->maze(), {{0, 3}}, 2);
+    EXPECT_TRUE(occupancy.isOccupied(1, {6, 3}));
+    EXPECT_TRUE(occupancy.isOccupied(1, {-1, 3}));
+    EXPECT_TRUE(occupancy.isOccupied(2, {5, 3}));
+}
+
+TEST_F(GhostOccupancyTest, firstCollision) {
+    GhostOccupancy occupancy(environmentModel_->maze(), {{5, 1}}, 4);
+
+    // Walking towards the ghost meets it halfway
+    EXPECT_EQ(occupancy.firstCollision({1, 1}, {Direction::RIGHT, Direction::RIGHT, Direction::RIGHT}), 2);
+
+    // Walking away from it is fine
+    EXPECT_FALSE(occupancy.firstCollision({1, 1}, {Direction::DOWN, Direction::DOWN, Direction::LEFT}));
+
+    // Steps beyond the horizon are not checked
+    GhostOccupancy shortOccupancy(environmentModel_->maze(), {{5, 1}}, 1);
+    EXPECT_FALSE(shortOccupancy.firstCollision({1, 1}, {Direction::RIGHT, Direction::RIGHT, Direction::RIGHT}));
+
+    // No ghosts, no collisions
+    GhostOccupancy noGhosts(environmentModel_->maze(), {}, 4);
+    EXPECT_FALSE(noGhosts.firstCollision({1, 1}, {Direction::RIGHT, Direction::RIGHT, Direction::RIGHT}));
+}
+
+} // namespace utils::a_star
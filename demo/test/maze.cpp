@@ -33,5 +33,57 @@ TEST(MazeState, positionConsideringTunnel) {
     EXPECT_EQ(maze.positionConsideringTunnel({3, -1}).y, 2);
 }
 
+TEST(MazeState, dotCounting) {
+    const char str[] = {"#####"
+                        "#..o#"
+                        "#. .#"
+                        "#.. #"
+                        "#####"};
+    Maze maze{makeCustomMazeState({5, 5}, str)};
 
-} // namespace utils::a_star
\ No newline at end of file
+    EXPECT_EQ(maze.dots().count(), 6);
+    EXPECT_EQ(maze.energizers().count(), 1);
+    EXPECT_EQ(maze.walls().count(), 16);
+
+    EXPECT_EQ(maze.dotsInRectangle({1, 1}, {3, 3}), 6);
+    EXPECT_EQ(maze.dotsInRectangle({2, 2}, {3, 3}), 2);
+
+    // Rectangles are clipped to the maze
+    EXPECT_EQ(maze.dotsInRectangle({-2, -2}, {1, 10}), 3);
+    EXPECT_EQ(maze.dotsInRectangle({5, 5}, {8, 8}), 0);
+
+    // Positions along the path are only counted once
+    EXPECT_EQ(maze.dotsAlongPath({{1, 1}, {2, 1}, {3, 1}, {2, 1}}), 2);
+    EXPECT_EQ(maze.dotsAlongPath({{1, 3}, {2, 3}, {3, 3}, {8, 8}}), 2);
+}
+
+TEST(MazeState, updatedKeepsSnapshots) {
+    const char str[] = {"#####"
+                        "#..o#"
+                        "#####"};
+    MazeState mazeState = makeCustomMazeState({5, 3}, str);
+    const Maze::ConstPtr maze = std::make_shared<const Maze>(mazeState);
+
+    // Without changes, the maze is reused
+    EXPECT_EQ(Maze::updated(maze, mazeState), maze);
+
+    // Eating a dot yields a new maze, the previous one stays untouched
+    mazeState[{1, 1}] = demo::entt::Tile::empty;
+    const Maze::ConstPtr updatedMaze = Maze::updated(maze, mazeState);
+    ASSERT_NE(updatedMaze, maze);
+    EXPECT_TRUE(maze->isDot({1, 1}));
+    EXPECT_EQ(maze->dots().count(), 2);
+    EXPECT_FALSE(updatedMaze->isDot({1, 1}));
+    EXPECT_EQ(updatedMaze->dots().count(), 1);
+
+    // The unchanged walls are shared, changed walls are not
+    EXPECT_EQ(&updatedMaze->walls(), &maze->walls());
+    mazeState[{2, 1}] = demo::entt::Tile::wall;
+    const Maze::ConstPtr mazeWithWall = Maze::updated(updatedMaze, mazeState);
+    EXPECT_NE(&mazeWithWall->walls(), &updatedMaze->walls());
+    EXPECT_TRUE(mazeWithWall->isWall({2, 1}));
+    EXPECT_FALSE(updatedMaze->walls().test({2, 1}));
+    EXPECT_EQ(updatedMaze->walls().count(), 12);
+}
+
+} // namespace utils::a_star
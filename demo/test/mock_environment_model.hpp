@@ -11,7 +11,7 @@ public:
     using Ptr = std::shared_ptr<MockEnvironmentModel>;
     using ConstPtr = std::shared_ptr<const MockEnvironmentModel>;
 
-    MockEnvironmentModel() : EnvironmentModel(dummyGame_) {
+    MockEnvironmentModel() : EnvironmentModel(dummyGame()) {
         initializeEntitiesInOppositeCorners();
         setEmptyMaze();
     }
@@ -21,9 +21,11 @@ public:
     }
     void setEntities(const Entities& entities) {
         entities_ = entities;
+        resetDerivedState();
     }
     void setPacmanPosition(const Position& position) {
         entities_.pacman.position = position;
+        resetDerivedState();
     }
     void setPacmanDirection(const Direction& direction) {
         entities_.pacman.direction = direction;
@@ -33,6 +35,7 @@ public:
         entities_.pinky.position = position;
         entities_.inky.position = position;
         entities_.clyde.position = position;
+        resetDerivedState();
     }
     void setGhostDirections(const Direction& direction) {
         entities_.blinky.direction = direction;
@@ -45,12 +48,14 @@ public:
         entities_.pinky.mode = mode;
         entities_.inky.mode = mode;
         entities_.clyde.mode = mode;
+        resetDerivedState();
     }
     void setScaredCountdown(const std::optional<int> countdown) {
         entities_.blinky.scaredCountdown = countdown;
         entities_.pinky.scaredCountdown = countdown;
         entities_.inky.scaredCountdown = countdown;
         entities_.clyde.scaredCountdown = countdown;
+        resetDerivedState();
     }
 
     void initializeEntitiesInOppositeCorners() {
@@ -68,6 +73,7 @@ public:
         maze_ = std::make_shared<Maze>(makeCustomMazeState({size.x, size.y}, str));
         astar_ = utils::AStar(maze_);
         clusterFinder_ = utils::DotClusterFinder(maze_);
+        resetDerivedState();
     }
     void setEmptyMaze() {
         const char str[] = {"##########"
@@ -84,7 +90,12 @@ public:
     }
 
 private:
-    entt::Game dummyGame_; // We just need this to initialize the base environment model
+    // We just need this to initialize the base environment model. It has to be constructed before the base class, so it
+    // can't be a member.
+    static const entt::Game& dummyGame() {
+        static entt::Game game;
+        return game;
+    }
 };
 
 } // namespace demo
@@ -1,5 +1,7 @@
 #include "demo/move_randomly_behavior.hpp"
 
+#include <map>
+
 #include <gtest/gtest.h>
 
 namespace demo {
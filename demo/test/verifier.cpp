@@ -41,6 +41,41 @@ TEST_F(VerifierTest, basicVerification) {
     EXPECT_FALSE(badResult.isOk());
 }
 
+TEST_F(VerifierTest, pathCrossingGhosts) {
+    const char str[] = {"#######"
+                        "#     #"
+                        "#######"};
+    environmentModel->setMaze({7, 3}, str);
+    environmentModel->setPacmanPosition({1, 1});
+    environmentModel->setGhostPositions({5, 1});
+    environmentModel->setGhostMode(GhostMode::CHASING);
+
+    // Pacman would meet the ghost on the second step
+    const Command towardsGhost{Path{Direction::RIGHT, Direction::RIGHT, Direction::RIGHT}};
+    EXPECT_FALSE(verifier.analyze(time, towardsGhost).isOk());
+
+    // A single step is fine as the ghost can't get there in time
+    EXPECT_TRUE(verifier.analyze(time, goodCommand).isOk());
+
+    // Scared ghosts are no danger
+    environmentModel->setGhostMode(GhostMode::SCARED);
+    EXPECT_TRUE(verifier.analyze(time, towardsGhost).isOk());
+}
+
+TEST_F(VerifierTest, pathTowardsDistantGhost) {
+    const char str[] = {"##############"
+                        "#            #"
+                        "##############"};
+    environmentModel->setMaze({14, 3}, str);
+    environmentModel->setPacmanPosition({1, 1});
+    environmentModel->setGhostPositions({12, 1});
+    environmentModel->setGhostMode(GhostMode::CHASING);
+
+    // The ghost could only meet Pacman after more steps than the verifier looks ahead
+    const Command towardsGhost{Path(6, Direction::RIGHT)};
+    EXPECT_TRUE(verifier.analyze(time, towardsGhost).isOk());
+}
+
 TEST_F(VerifierTest, verifierInPriorityArbitrator) {
     using PriorityArbitrator = arbitration_graphs::PriorityArbitrator<Command, Command, Verifier, VerificationResult>;
 
@@ -3,9 +3,12 @@
 #include "crow_config.hpp"
 
 #include <crow.h>
+#include <chrono>
+#include <cstddef>
 #include <filesystem>
 #include <mutex>
 #include <set>
+#include <utility>
 
 #include <glog/logging.h>
 
@@ -25,7 +28,8 @@ namespace arbitration_graphs::gui {
  * The server serves static GUI files from a directory determined by environment variables or predefined paths.
  * The "/" route serves the main index.html file, while "/<path>" serves other static files.
  * The "/status" WebSocket route allows clients to connect for real-time updates; use broadcast() to send messages to
- * all connected clients.
+ * all connected clients. Use publish() instead to only produce a message when a client is connected and the next frame
+ * is due, so that an unobserved server doesn't cost anything.
  *
  * Example usage:
  * @code
@@ -34,10 +38,15 @@ namespace arbitration_graphs::gui {
  *   WebServer server(8080, false);
  *   server.start(); // Start server manually
  *   server.stop();  // Stop server manually
+ *
+ *   server.publishInterval(std::chrono::milliseconds(50));
+ *   server.publish([&]() { return agent.yamlString(time); }); // Only serializes if someone is listening
  * @endcode
  */
 class WebServer {
 public:
+    using Clock = std::chrono::steady_clock;
+
     WebServer(int port, bool autostart = false, crow::LogLevel loglevel = crow::LogLevel::Warning)
             : static_directory_{crow::utility::normalize_path(dataDirectory())}, port_{port}, autostart_{autostart} {
 
@@ -55,6 +64,8 @@ public:
             .onopen([this](crow::websocket::connection& conn) {
                 std::lock_guard<std::mutex> guard(connections_mutex_);
                 connections_.insert(&conn);
+                // New clients shouldn't wait for the next frame
+                next_publish_time_ = Clock::time_point::min();
                 CROW_LOG_INFO << "New WebSocket connection opened!";
             })
             .onclose([this](crow::websocket::connection& conn, const std::string& reason) {
@@ -107,6 +118,38 @@ public:
         CROW_LOG_DEBUG << "Message sent to all clients: " << message;
     }
 
+    // Function to send a message produced by snapshot() to all connected clients, if there are any and the next frame
+    // is due. Returns whether the snapshot has been produced and sent.
+    template <typename SnapshotFunctionT>
+    bool publish(SnapshotFunctionT&& snapshot) {
+        {
+            std::lock_guard<std::mutex> guard(connections_mutex_);
+            const Clock::time_point now = Clock::now();
+            if (connections_.empty() || now < next_publish_time_) {
+                return false;
+            }
+            next_publish_time_ = now + publish_interval_;
+        }
+        broadcast(std::forward<SnapshotFunctionT>(snapshot)());
+        return true;
+    }
+
+    // Function to set the minimum time between two frames sent by publish(), zero (default) publishes on every call
+    void publishInterval(Clock::duration interval) {
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        publish_interval_ = interval;
+    }
+
+    // Function to query the number of clients connected to the "/status" WebSocket
+    std::size_t subscriberCount() const {
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        return connections_.size();
+    }
+
+    bool hasSubscribers() const {
+        return subscriberCount() > 0;
+    }
+
     void loglevel(crow::LogLevel level) {
         app_.loglevel(level);
     }
@@ -143,7 +186,9 @@ private:
 
     crow::SimpleApp app_;
     std::set<crow::websocket::connection*> connections_;
-    std::mutex connections_mutex_;
+    mutable std::mutex connections_mutex_;
+    Clock::duration publish_interval_{Clock::duration::zero()};
+    Clock::time_point next_publish_time_{Clock::time_point::min()};
     std::future<void> _f;
 
     const std::string static_directory_;
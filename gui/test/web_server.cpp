@@ -40,14 +40,187 @@
 
 #include "gtest/gtest.h"
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <future>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <thread>
 
 using namespace arbitration_graphs;
 
+namespace {
+
+/**
+ * @brief A minimal WebSocket client for the tests, as Crow only provides the server side.
+ *
+ * Supports just what the tests need: the opening handshake, receiving unfragmented text frames from the server and
+ * closing the connection.
+ */
+class WebSocketClient {
+public:
+    explicit WebSocketClient(int port) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        // The server starts asynchronously, so retry until it accepts connections
+        while (!connectTo(port) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (socket_ < 0) {
+            return;
+        }
+
+        const std::string request = "GET /status HTTP/1.1\r\n"
+                                    "Host: 127.0.0.1:" +
+                                    std::to_string(port) +
+                                    "\r\n"
+                                    "Upgrade: websocket\r\n"
+                                    "Connection: Upgrade\r\n"
+                                    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                                    "Sec-WebSocket-Version: 13\r\n"
+                                    "\r\n";
+        if (!sendAll(request)) {
+            return;
+        }
+
+        std::string response;
+        char character;
+        while (response.find("\r\n\r\n") == std::string::npos && receiveAll(&character, 1)) {
+            response.push_back(character);
+        }
+        connected_ = response.rfind("HTTP/1.1 101", 0) == 0;
+    }
+    WebSocketClient(const WebSocketClient&) = delete;
+    WebSocketClient& operator=(const WebSocketClient&) = delete;
+
+    ~WebSocketClient() {
+        close();
+    }
+
+    bool connected() const {
+        return connected_;
+    }
+
+    /// Waits for the next text message, std::nullopt on timeout or if the connection has been closed
+    std::optional<std::string> receive() {
+        while (connected_) {
+            std::array<std::uint8_t, 2> header;
+            if (!receiveAll(header.data(), header.size())) {
+                return std::nullopt;
+            }
+            const std::uint8_t opcode = header[0] & 0x0FU;
+
+            std::uint64_t length = header[1] & 0x7FU;
+            if (length >= 126) {
+                std::array<std::uint8_t, 8> extendedLength;
+                const std::size_t numBytes = length == 126 ? 2 : 8;
+                if (!receiveAll(extendedLength.data(), numBytes)) {
+                    return std::nullopt;
+                }
+                length = 0;
+                for (std::size_t i = 0; i < numBytes; i++) {
+                    length = (length << 8U) | extendedLength[i];
+                }
+            }
+
+            std::string payload(length, '\0');
+            if (!receiveAll(payload.data(), payload.size())) {
+                return std::nullopt;
+            }
+            if (opcode == 0x1) {
+                return payload;
+            }
+            if (opcode == 0x8) {
+                connected_ = false;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void close() {
+        if (connected_) {
+            // Client frames have to be masked, a zero mask leaves the status code 1000 (normal closure) as is
+            const std::array<char, 8> closeFrame{'\x88', '\x82', 0, 0, 0, 0, '\x03', '\xE8'};
+            sendAll(std::string(closeFrame.begin(), closeFrame.end()));
+            connected_ = false;
+        }
+        if (socket_ >= 0) {
+            ::close(socket_);
+            socket_ = -1;
+        }
+    }
+
+private:
+    bool connectTo(int port) {
+        socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (socket_ < 0) {
+            return false;
+        }
+        timeval timeout{5, 0};
+        setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<std::uint16_t>(port));
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (::connect(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0) {
+            return true;
+        }
+        ::close(socket_);
+        socket_ = -1;
+        return false;
+    }
+
+    bool sendAll(const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            const ssize_t result = ::send(socket_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return false;
+            }
+            sent += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    bool receiveAll(void* data, std::size_t size) {
+        std::size_t received = 0;
+        while (received < size) {
+            const ssize_t result = ::recv(socket_, static_cast<char*>(data) + received, size - received, 0);
+            if (result <= 0) {
+                return false;
+            }
+            received += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    int socket_{-1};
+    bool connected_{false};
+};
+
+/// Polls the given predicate until it holds or the timeout elapsed
+template <typename PredicateT>
+bool waitFor(const PredicateT& predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+} // namespace
+
 TEST(WebServer, Autostart) {
 
     // We run the test in a thread, in order to test for timeouts
@@ -88,4 +261,93 @@ TEST(WebServer, CustomStartStop) {
 
     // Make sure that the server shuts down cleanly
     ASSERT_TRUE(asyncFuture.wait_for(std::chrono::seconds(10)) != std::future_status::timeout);
-}
\ No newline at end of file
+}
+
+TEST(WebServer, PublishWithoutSubscribers) {
+
+    // We run the test in a thread, in order to test for timeouts
+    auto asyncFuture = std::async(std::launch::async, []() {
+        // Each test binds its own port, so that ctest can run the test executables in parallel
+        gui::WebServer server{8082, true};
+        EXPECT_EQ(0, server.subscriberCount());
+        EXPECT_FALSE(server.hasSubscribers());
+
+        int numSnapshots = 0;
+        auto snapshot = [&numSnapshots]() {
+            numSnapshots++;
+            return std::string("Hello from the server!");
+        };
+
+        // Without any clients connected, the snapshot must not even be produced
+        for (int i = 0; i < 3; i++) {
+            EXPECT_FALSE(server.publish(snapshot));
+        }
+        server.publishInterval(std::chrono::milliseconds(100));
+        EXPECT_FALSE(server.publish(snapshot));
+
+        EXPECT_EQ(0, numSnapshots);
+    });
+
+    // Make sure that the server shuts down cleanly
+    ASSERT_TRUE(asyncFuture.wait_for(std::chrono::seconds(10)) != std::future_status::timeout);
+}
+
+TEST(WebServer, PublishToSubscribers) {
+
+    // We run the test in a thread, in order to test for timeouts
+    auto asyncFuture = std::async(std::launch::async, []() {
+        constexpr int port = 8083;
+        gui::WebServer server{port, true};
+
+        int numSnapshots = 0;
+        auto snapshot = [&numSnapshots]() { return "Snapshot " + std::to_string(++numSnapshots); };
+
+        WebSocketClient client{port};
+        ASSERT_TRUE(client.connected());
+        ASSERT_TRUE(waitFor([&server]() { return server.subscriberCount() == 1; }));
+        EXPECT_TRUE(server.hasSubscribers());
+
+        // Broadcasts and snapshots reach the connected client
+        server.broadcast("Hello from the server!");
+        EXPECT_EQ("Hello from the server!", client.receive());
+
+        EXPECT_TRUE(server.publish(snapshot));
+        EXPECT_EQ("Snapshot 1", client.receive());
+
+        // Within the publish interval, the snapshot isn't even produced
+        server.publishInterval(std::chrono::milliseconds(200));
+        EXPECT_TRUE(server.publish(snapshot));
+        EXPECT_EQ("Snapshot 2", client.receive());
+        EXPECT_FALSE(server.publish(snapshot));
+        EXPECT_EQ(2, numSnapshots);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        EXPECT_TRUE(server.publish(snapshot));
+        EXPECT_EQ("Snapshot 3", client.receive());
+
+        // A new client doesn't have to wait for the next frame
+        server.publishInterval(std::chrono::seconds(60));
+        EXPECT_TRUE(server.publish(snapshot));
+        EXPECT_EQ("Snapshot 4", client.receive());
+        EXPECT_FALSE(server.publish(snapshot));
+
+        WebSocketClient otherClient{port};
+        ASSERT_TRUE(otherClient.connected());
+        ASSERT_TRUE(waitFor([&server]() { return server.subscriberCount() == 2; }));
+        EXPECT_TRUE(server.publish(snapshot));
+        EXPECT_EQ("Snapshot 5", client.receive());
+        EXPECT_EQ("Snapshot 5", otherClient.receive());
+        EXPECT_FALSE(server.publish(snapshot));
+
+        // Once all clients disconnected, nothing is published anymore
+        client.close();
+        otherClient.close();
+        ASSERT_TRUE(waitFor([&server]() { return server.subscriberCount() == 0; }));
+        server.publishInterval(std::chrono::milliseconds(0));
+        EXPECT_FALSE(server.publish(snapshot));
+        EXPECT_EQ(5, numSnapshots);
+    });
+
+    // Make sure that the server shuts down cleanly
+    ASSERT_TRUE(asyncFuture.wait_for(std::chrono::seconds(30)) != std::future_status::timeout);
+}
@@ -5,6 +5,7 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <yaml-cpp/yaml.h>
@@ -38,6 +39,8 @@ public:
     using Ptr = std::shared_ptr<Arbitrator>;
     using ConstPtr = std::shared_ptr<const Arbitrator>;
 
+    using VerificationCache = verification::ResultCache<SubCommandT, VerificationResultT>;
+
     /*!
      * \brief The Option struct holds a behavior option of the arbitrator and corresponding flags
      *
@@ -60,16 +63,54 @@ public:
         }
         virtual ~Option() = default;
 
+        using EvaluationPolicy = util_caching::policies::ApproximateTime<Time, std::chrono::microseconds>;
+
         typename Behavior<SubCommandT>::Ptr behavior_;
         FlagsT flags_;
         mutable util_caching::Cache<Time, SubCommandT> command_;
         mutable util_caching::Cache<Time, VerificationResultT> verificationResult_;
 
+        //! If set, conditions and command of this option are re-evaluated only once per period and reused otherwise
+        std::optional<Duration> evaluationPeriod_;
+        mutable util_caching::Cache<Time, bool> invocationCondition_;
+        mutable util_caching::Cache<Time, bool> commitmentCondition_;
+        //! Time of the last actual evaluation of each of them, i.e. excluding reused results
+        mutable std::optional<Time> lastCommandEvaluation_;
+        mutable std::optional<Time> lastInvocationConditionEvaluation_;
+        mutable std::optional<Time> lastCommitmentConditionEvaluation_;
+
+        //! The result of the last evaluation together with the revisions of the behaviors inputs it is valid for
+        template <typename ValueT>
+        struct InputCache {
+            InputRevisions revisions;
+            std::optional<ValueT> value;
+        };
+
+        //! Results of the last evaluation, reused as long as the revisions of the behaviors inputs did not change
+        mutable InputCache<SubCommandT> commandByInputs_;
+        mutable InputCache<bool> invocationConditionByInputs_;
+        mutable InputCache<bool> commitmentConditionByInputs_;
+
         SubCommandT getCommand(const Time& time) const {
-            if (!command_.cached(time)) {
-                command_.cache(time, behavior_->getCommand(time));
-            }
-            return command_.cached(time).value();
+            return evaluate(command_, commandByInputs_, lastCommandEvaluation_, time, true, [this, &time]() {
+                return behavior_->getCommand(time);
+            });
+        }
+        bool checkInvocationCondition(const Time& time) const {
+            return evaluate(invocationCondition_,
+                            invocationConditionByInputs_,
+                            lastInvocationConditionEvaluation_,
+                            time,
+                            false,
+                            [this, &time]() { return behavior_->checkInvocationCondition(time); });
+        }
+        bool checkCommitmentCondition(const Time& time) const {
+            return evaluate(commitmentCondition_,
+                            commitmentConditionByInputs_,
+                            lastCommitmentConditionEvaluation_,
+                            time,
+                            false,
+                            [this, &time]() { return behavior_->checkCommitmentCondition(time); });
         }
 
         bool hasFlag(const FlagsT& flag_to_check) const {
@@ -101,6 +142,53 @@ public:
          * \return      Yaml representation of this behavior
          */
         virtual YAML::Node toYaml(const Time& time) const;
+
+    private:
+        EvaluationPolicy evaluationPolicy() const {
+            return EvaluationPolicy(std::chrono::duration_cast<std::chrono::microseconds>(*evaluationPeriod_).count());
+        }
+
+        /*!
+         * \brief Returns a cached result, if it is still valid, otherwise evaluates and caches a new one
+         *
+         * Results are reused, if the behaviors inputs did not change since its last evaluation or if the evaluation
+         * period did not elapse yet. Without both, results are only reused for the exact same time, if requested.
+         */
+        template <typename ValueT, typename FunctionT>
+        ValueT evaluate(util_caching::Cache<Time, ValueT>& cache,
+                        InputCache<ValueT>& cacheByInputs,
+                        std::optional<Time>& lastEvaluation,
+                        const Time& time,
+                        const bool reuseForSameTime,
+                        const FunctionT& function) const {
+            // Revisions are compared and updated in place, so this does not allocate once the cache has been filled
+            if (cacheByInputs.value && behavior_->inputRevisionsMatch(cacheByInputs.revisions)) {
+                return *cacheByInputs.value;
+            }
+            if (evaluationPeriod_) {
+                if (const std::optional<ValueT> value = cache.cached(time, evaluationPolicy())) {
+                    return *value;
+                }
+            } else if (reuseForSameTime) {
+                if (const std::optional<ValueT> value = cache.cached(time)) {
+                    return *value;
+                }
+            }
+
+            // Read the revisions before evaluating, so that inputs changing meanwhile invalidate the result
+            const bool dependsOnInputs = !behavior_->inputs().empty();
+            if (dependsOnInputs) {
+                behavior_->readInputRevisions(cacheByInputs.revisions);
+                cacheByInputs.value.reset();
+            }
+            const ValueT value = function();
+            cache.cache(time, value);
+            if (dependsOnInputs) {
+                cacheByInputs.value = value;
+            }
+            lastEvaluation = time;
+            return value;
+        }
     };
     using Options = std::vector<typename Option::Ptr>;
     using ConstOptions = std::vector<typename Option::ConstPtr>;
@@ -136,13 +224,57 @@ public:
             "checkInvocationCondition() or checkCommitmentCondition() is true!");
     }
 
+    const VerifierT& verifier() const {
+        return verifier_;
+    }
+
+    /*!
+     * \brief Memoize verification results of identical commands in the given cache
+     *
+     * Without a cache (the default), every command is verified on its own. The cache can be shared with other
+     * arbitrators using the same verifier. Pass nullptr to disable caching again.
+     *
+     * \see verification::ResultCache
+     */
+    void setVerificationCache(const typename VerificationCache::Ptr& verificationCache) {
+        verificationCache_ = verificationCache;
+    }
+    typename VerificationCache::Ptr verificationCache() const {
+        return verificationCache_;
+    }
+
+    /*!
+     * \brief Evaluate the option at the given index only once per period
+     *
+     * Invocation condition, commitment condition and command of the option are re-evaluated only if the given period
+     * has elapsed since their last evaluation, otherwise the previous results are reused. This allows to run
+     * behaviors that rely on slowly updated inputs at a lower rate than the arbitration graph itself.
+     *
+     * \param optionIndex  Position index of the option within options()
+     * \param period       Evaluation period, pass std::nullopt to evaluate the option every cycle again
+     */
+    void setEvaluationPeriod(const std::size_t& optionIndex, const std::optional<Duration>& period) {
+        if (optionIndex >= behaviorOptions_.size()) {
+            throw InvalidArgumentsError("Invalid call of setEvaluationPeriod(): Option index " +
+                                        std::to_string(optionIndex) + " is out of range!");
+        }
+        const typename Option::Ptr& option = behaviorOptions_.at(optionIndex);
+        option->evaluationPeriod_ = period;
+        option->command_.reset();
+        option->invocationCondition_.reset();
+        option->commitmentCondition_.reset();
+        option->lastCommandEvaluation_.reset();
+        option->lastInvocationConditionEvaluation_.reset();
+        option->lastCommitmentConditionEvaluation_.reset();
+    }
+
     ConstOptions options() const {
         return ConstOptions(behaviorOptions_.begin(), behaviorOptions_.end());
     }
 
     bool checkInvocationCondition(const Time& time) const override {
         for (auto& option : behaviorOptions_) {
-            if (option->behavior_->checkInvocationCondition(time)) {
+            if (option->checkInvocationCondition(time)) {
                 return true;
             }
         }
@@ -150,7 +282,7 @@ public:
     }
     bool checkCommitmentCondition(const Time& time) const override {
         if (activeBehavior_) {
-            if (activeBehavior_->behavior_->checkCommitmentCondition(time)) {
+            if (activeBehavior_->checkCommitmentCondition(time)) {
                 return true;
             } else {
                 return checkInvocationCondition(time);
@@ -173,6 +305,36 @@ public:
         return activeBehavior_ != nullptr;
     }
 
+    /*!
+     * \brief Returns the position index of the active option within options(), std::nullopt if none is active
+     */
+    std::optional<std::size_t> activeOptionIndex() const {
+        if (!activeBehavior_) {
+            return std::nullopt;
+        }
+        return getOptionIndex(activeBehavior_);
+    }
+
+    /*!
+     * \brief Marks the option at the given index as active without calling its gainControl()
+     *
+     * Meant to restore the state of a copied or deserialized graph, whose behaviors are already in the respective
+     * state. Use gainControl() and getCommand() for regular arbitration.
+     *
+     * \param optionIndex  Position index of the option within options(), std::nullopt to deactivate all options
+     */
+    void restoreActiveOption(const std::optional<std::size_t>& optionIndex) {
+        if (!optionIndex) {
+            activeBehavior_.reset();
+            return;
+        }
+        if (*optionIndex >= behaviorOptions_.size()) {
+            throw InvalidArgumentsError("Invalid call of restoreActiveOption(): Option index " +
+                                        std::to_string(*optionIndex) + " is out of range!");
+        }
+        activeBehavior_ = behaviorOptions_.at(*optionIndex);
+    }
+
     /*!
      * \brief Writes a string representation of the Arbitrator object with its current state to the output stream.
      *
@@ -232,6 +394,53 @@ protected:
      */
     std::optional<SubCommandT> getAndVerifyCommand(const typename Option::Ptr& option, const Time& time) const;
 
+    /*!
+     * @brief Call getCommand on the given option without verifying its returned command
+     *
+     * If the option throws, a failed verification result is cached (or reset for nested arbitrators without safe
+     * applicable option), so that this is handled just like in getAndVerifyCommand().
+     *
+     * @param option    Behavior option to call
+     * @param time      Expected execution time point of this behaviors command
+     * @return Command of the given option, if it did not throw, otherwise nullopt
+     */
+    std::optional<SubCommandT> getOptionCommand(const typename Option::Ptr& option, const Time& time) const;
+
+    /*!
+     * @brief Cache the verification result of the given option and decide whether its command can be used
+     *
+     * @param option                Behavior option the verification result belongs to
+     * @param verificationResult    Verification result of the options command
+     * @param time                  Expected execution time point of this behaviors command
+     * @return true, if the command passed verification or the option is flagged as FALLBACK
+     */
+    bool acceptVerificationResult(const typename Option::Ptr& option,
+                                  const VerificationResultT& verificationResult,
+                                  const Time& time) const;
+
+    /*!
+     * @brief Analyze the given command with the verifier, reusing results from the verification cache if possible
+     *
+     * @param time      Expected execution time point of this behaviors command
+     * @param command   Command to verify
+     * @return Verification result of the given command
+     */
+    VerificationResultT verify(const Time& time, const SubCommandT& command) const;
+
+    /*!
+     * @brief Analyze all given commands at once
+     *
+     * Uses the batch interface of the verifier, if it provides one (\see verification::HasAnalyzeBatch),
+     * otherwise falls back to verify() for each command. Cached results are reused in both cases.
+     * Exceptions thrown by the batch interface are passed on, as they can't be attributed to a single command.
+     *
+     * @param time      Expected execution time point of these commands
+     * @param commands  Commands to verify
+     * @return Verification results in the order of the given commands, nullopt if verifying that command threw
+     */
+    std::vector<std::optional<VerificationResultT>> verifyBatch(const Time& time,
+                                                                const std::vector<SubCommandT>& commands) const;
+
     /*!
      * @brief Get and verify the command from the active behavior, if there is an active one
      *
@@ -254,6 +463,7 @@ protected:
     typename Option::Ptr activeBehavior_;
 
     VerifierT verifier_;
+    typename VerificationCache::Ptr verificationCache_;
 };
 } // namespace arbitration_graphs
 
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <vector>
 
 #include <yaml-cpp/yaml.h>
 
+#include "input_signal.hpp"
 #include "types.hpp"
 
 
@@ -99,6 +103,53 @@ public:
     virtual void loseControl(const Time& time) {
     }
 
+    /*!
+     * \brief Declares that invocation condition, commitment condition and command depend on the given input only
+     *
+     * Once a behavior declared its inputs, arbitrators reuse its previous conditions and command as long as none of the
+     * inputs changed. So make sure to declare all inputs, including the time if the behavior depends on it.
+     *
+     * \param input    Input signal this behavior depends on
+     */
+    void dependsOn(const InputSignal::ConstPtr& input) {
+        inputs_.push_back(input);
+    }
+    const std::vector<InputSignal::ConstPtr>& inputs() const {
+        return inputs_;
+    }
+
+    /*!
+     * \brief Writes the current revisions of all declared inputs into the given vector
+     *
+     * The vector is overwritten in place, so passing the same vector again does not allocate.
+     *
+     * \param revisions  Receives the current input revisions, in the order the inputs have been declared
+     */
+    void readInputRevisions(InputRevisions& revisions) const {
+        revisions.resize(inputs_.size());
+        for (std::size_t i = 0; i < inputs_.size(); ++i) {
+            revisions[i] = inputs_[i]->revision();
+        }
+    }
+
+    /*!
+     * \brief Checks whether none of the declared inputs changed since the given revisions have been read
+     *
+     * \param revisions  Input revisions, as written by readInputRevisions()
+     * \return           true if the behavior declared inputs and all of them are still at the given revisions
+     */
+    bool inputRevisionsMatch(const InputRevisions& revisions) const {
+        if (inputs_.empty() || revisions.size() != inputs_.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < inputs_.size(); ++i) {
+            if (revisions[i] != inputs_[i]->revision()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /*!
      * \brief Returns a string representation of the behavior object with its current state using to_stream()
      *
@@ -148,6 +199,9 @@ public:
     virtual YAML::Node toYaml(const Time& time) const;
 
     const std::string name_;
+
+protected:
+    std::vector<InputSignal::ConstPtr> inputs_;
 };
 } // namespace arbitration_graphs
 
@@ -1,13 +1,17 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <iomanip>
 #include <memory>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include <yaml-cpp/yaml.h>
 
 #include "arbitrator.hpp"
+#include "worker_pool.hpp"
 
 
 namespace arbitration_graphs {
@@ -16,8 +20,29 @@ template <typename SubCommandT>
 struct CostEstimator {
     using Ptr = std::shared_ptr<CostEstimator>;
     using ConstPtr = std::shared_ptr<const CostEstimator>;
+    //! References to the commands of a batch, which are owned by the CostArbitrator
+    using CommandRefs = std::vector<std::reference_wrapper<const SubCommandT>>;
 
     virtual double estimateCost(const SubCommandT& command, const bool isActive) = 0;
+
+    /*!
+     * \brief Estimates the costs of multiple commands at once
+     *
+     * Override this, if your cost function can be evaluated more efficiently on a batch of commands (e.g. vectorized).
+     * The CostArbitrator calls this once per cost estimator instance and cycle with all commands to be rated by it.
+     *
+     * \param commands   Commands to rate
+     * \param isActive   Whether the option that returned the corresponding command is active
+     * \return           Estimated costs in the order of the given commands
+     */
+    virtual std::vector<double> estimateCosts(const CommandRefs& commands, const std::vector<bool>& isActive) {
+        std::vector<double> costs;
+        costs.reserve(commands.size());
+        for (std::size_t i = 0; i < commands.size(); ++i) {
+            costs.push_back(estimateCost(commands.at(i), isActive.at(i)));
+        }
+        return costs;
+    }
 };
 
 template <typename CommandT,
@@ -86,6 +111,29 @@ public:
         this->behaviorOptions_.push_back(option);
     }
 
+    /*!
+     * \brief Sets the number of threads used to evaluate the options
+     *
+     * With more than one thread, the commands of the options are collected in parallel and the cost estimators rate
+     * their batches in parallel. Options of the same behavior instance are evaluated one after another by the same
+     * thread and each cost estimator rates its batch in a single call, so each of these is only called by one thread
+     * at a time. Different ones run concurrently and must not share unsynchronized state, this includes behaviors
+     * shared with nested arbitrators. The verifier is always called sequentially. Note that const methods are not
+     * necessarily thread-safe, e.g. an environment model building caches lazily must not be queried concurrently.
+     *
+     * The threads are started here and reused in each cycle. Still, handing the options over to them costs a few
+     * microseconds per cycle, which only pays off for expensive behaviors and cost estimators.
+     *
+     * \param numThreads  Maximum number of threads, 0 or 1 (default) evaluates the options sequentially
+     */
+    void setNumThreads(const std::size_t numThreads) {
+        numThreads_ = std::max<std::size_t>(numThreads, 1);
+        workerPool_ = numThreads_ > 1 ? std::make_unique<WorkerPool>(numThreads_) : nullptr;
+    }
+    std::size_t numThreads() const {
+        return numThreads_;
+    }
+
     /*!
      * \brief Returns a yaml representation of the arbitrator object with its current state
      *
@@ -108,39 +156,202 @@ private:
             option->last_estimated_cost_ = std::nullopt;
         }
 
-        // sort given options by using a multiset
-        std::multimap<double, typename ArbitratorBase::Option::Ptr> sortedOptionsMap;
+        // get all commands first, so that they can be verified and rated in batches
+        Candidates& candidates = candidates_;
+        candidates.clear();
 
-        for (auto& optionBase : options) {
-            typename Option::Ptr option = std::dynamic_pointer_cast<Option>(optionBase);
-
-            const bool isActive = this->isActive(option);
-
-            std::optional<SubCommandT> command;
-            if (isActive) {
-                command = this->getAndVerifyCommand(option, time);
+        candidates.optionCommands.resize(options.size());
+        const auto getCommand = [&](const std::size_t index) {
+            const typename Option::Ptr option = std::dynamic_pointer_cast<Option>(options[index]);
+            if (this->isActive(option)) {
+                candidates.optionCommands[index] = this->getOptionCommand(option, time);
             } else {
                 option->behavior_->gainControl(time);
-                command = this->getAndVerifyCommand(option, time);
+                candidates.optionCommands[index] = this->getOptionCommand(option, time);
                 option->behavior_->loseControl(time);
             }
-            if (!command) {
+        };
+        if (!workerPool_) {
+            for (std::size_t index = 0; index < options.size(); ++index) {
+                getCommand(index);
+            }
+        } else {
+            // options of the same behavior instance must not be evaluated concurrently
+            const std::size_t numGroups = groupOptionsByBehavior(options);
+            const auto getCommands = [&groups = candidates.behaviorGroups, &getCommand](const std::size_t group) {
+                for (const std::size_t& index : groups[group]) {
+                    getCommand(index);
+                }
+            };
+            workerPool_->forEachIndex(numGroups, getCommands);
+        }
+        for (std::size_t index = 0; index < options.size(); ++index) {
+            std::optional<SubCommandT>& command = candidates.optionCommands[index];
+            if (command) {
+                candidates.options.push_back(std::dynamic_pointer_cast<Option>(options[index]));
+                candidates.commands.push_back(std::move(command.value()));
+            }
+        }
+        candidates.optionCommands.clear();
+        candidates.costs.assign(candidates.options.size(), 0.);
+
+        std::vector<bool>& isVerified = candidates.isVerified;
+        isVerified.assign(candidates.options.size(), false);
+        try {
+            const std::vector<std::optional<VerificationResultT>> verificationResults =
+                this->verifyBatch(time, candidates.commands);
+            for (std::size_t i = 0; i < candidates.options.size(); ++i) {
+                if (!verificationResults.at(i)) {
+                    // verifying this command threw an exception
+                    candidates.options[i]->verificationResult_.cache(time, VerificationResultT{false});
+                    continue;
+                }
+                isVerified[i] =
+                    this->acceptVerificationResult(candidates.options[i], verificationResults.at(i).value(), time);
+            }
+        } catch (const std::exception& e) {
+            // Catch all exceptions of a batch verifier and cache failed verification results
+            for (const auto& option : candidates.options) {
+                option->verificationResult_.cache(time, VerificationResultT{false});
+            }
+            VLOG(1) << "Verifying the commands of " << this->name_ << " threw an exception: " << e.what();
+        }
+
+        // group all verified commands of the same cost estimator in a single pass, so that each rates them in one call
+        std::size_t numBatches = 0;
+        for (std::size_t i = 0; i < candidates.options.size(); ++i) {
+            if (!isVerified[i]) {
                 continue;
             }
+            const typename CostEstimator<SubCommandT>::Ptr& costEstimator = candidates.options[i]->costEstimator_;
+            const auto [batchIndex, isNewBatch] = candidates.batchIndices.try_emplace(costEstimator.get(), numBatches);
+            if (isNewBatch) {
+                if (candidates.batches.size() <= numBatches) {
+                    candidates.batches.emplace_back();
+                }
+                candidates.batches[numBatches++].costEstimator = costEstimator;
+            }
+
+            Batch& batch = candidates.batches[batchIndex->second];
+            batch.indices.push_back(i);
+            batch.commands.push_back(std::cref(candidates.commands[i]));
+            batch.isActive.push_back(this->isActive(candidates.options[i]));
+        }
+
+        const auto rateBatch = [&batches = candidates.batches](const std::size_t index) {
+            Batch& batch = batches[index];
+            batch.costs = batch.costEstimator->estimateCosts(batch.commands, batch.isActive);
+        };
+        if (!workerPool_) {
+            for (std::size_t index = 0; index < numBatches; ++index) {
+                rateBatch(index);
+            }
+        } else {
+            workerPool_->forEachIndex(numBatches, rateBatch);
+        }
 
-            double cost = option->costEstimator_->estimateCost(command.value(), isActive);
-            option->last_estimated_cost_ = cost;
-            sortedOptionsMap.insert({cost, option});
+        for (std::size_t i = 0; i < numBatches; ++i) {
+            const Batch& batch = candidates.batches[i];
+            for (std::size_t k = 0; k < batch.indices.size(); ++k) {
+                const std::size_t index = batch.indices[k];
+                candidates.costs[index] = batch.costs.at(k);
+                candidates.options[index]->last_estimated_cost_ = batch.costs.at(k);
+                candidates.sortedIndices.push_back(index);
+            }
         }
 
-        // copy back to vector (these are pointers anyway, so copying is cheap)
+        // sort indices of rated options by costs, ties keep the order of the given options
+        std::sort(candidates.sortedIndices.begin(),
+                  candidates.sortedIndices.end(),
+                  [&costs = candidates.costs](const std::size_t& lhs, const std::size_t& rhs) {
+                      return costs[lhs] < costs[rhs] || (costs[lhs] == costs[rhs] && lhs < rhs);
+                  });
+
         typename ArbitratorBase::Options sortedOptionsVector;
-        sortedOptionsVector.reserve(options.size());
-        for (const auto& sortedOption : sortedOptionsMap) {
-            sortedOptionsVector.push_back(sortedOption.second);
+        sortedOptionsVector.reserve(candidates.sortedIndices.size());
+        for (const std::size_t& index : candidates.sortedIndices) {
+            sortedOptionsVector.push_back(candidates.options[index]);
         }
+        // release options and commands, but keep the allocated memory
+        candidates.clear();
         return sortedOptionsVector;
     }
+
+    /*!
+     * \brief Groups the indices of the given options by their behavior instance into candidates_.behaviorGroups
+     *
+     * \return Number of groups, in the order of the first option of each behavior
+     */
+    std::size_t groupOptionsByBehavior(const typename ArbitratorBase::Options& options) const {
+        Candidates& candidates = candidates_;
+        std::size_t numGroups = 0;
+        for (std::size_t index = 0; index < options.size(); ++index) {
+            const auto [groupIndex, isNewGroup] =
+                candidates.behaviorGroupIndices.try_emplace(options[index]->behavior_.get(), numGroups);
+            if (isNewGroup) {
+                if (candidates.behaviorGroups.size() <= numGroups) {
+                    candidates.behaviorGroups.emplace_back();
+                }
+                candidates.behaviorGroups[numGroups++].clear();
+            }
+            candidates.behaviorGroups[groupIndex->second].push_back(index);
+        }
+        candidates.behaviorGroupIndices.clear();
+        return numGroups;
+    }
+
+    /*!
+     * \brief Commands of a single cost estimator, which are rated in one call
+     */
+    struct Batch {
+        void clear() {
+            costEstimator.reset();
+            indices.clear();
+            commands.clear();
+            isActive.clear();
+            costs.clear();
+        }
+
+        typename CostEstimator<SubCommandT>::Ptr costEstimator;
+        std::vector<std::size_t> indices;
+        typename CostEstimator<SubCommandT>::CommandRefs commands;
+        std::vector<bool> isActive;
+        std::vector<double> costs;
+    };
+
+    /*!
+     * \brief Buffers used while sorting options by costs
+     *
+     * These are kept between calls, so that their memory can be reused instead of being reallocated each cycle.
+     */
+    struct Candidates {
+        void clear() {
+            options.clear();
+            optionCommands.clear();
+            commands.clear();
+            sortedIndices.clear();
+            batchIndices.clear();
+            for (auto& batch : batches) {
+                batch.clear();
+            }
+        }
+
+        std::vector<typename Option::Ptr> options;
+        std::vector<std::optional<SubCommandT>> optionCommands;
+        std::vector<SubCommandT> commands;
+        std::vector<bool> isVerified;
+        std::vector<double> costs;
+        std::vector<std::size_t> sortedIndices;
+
+        std::vector<Batch> batches;
+        std::unordered_map<const CostEstimator<SubCommandT>*, std::size_t> batchIndices;
+
+        std::vector<std::vector<std::size_t>> behaviorGroups;
+        std::unordered_map<const Behavior<SubCommandT>*, std::size_t> behaviorGroupIndices;
+    };
+    std::size_t numThreads_{1};
+    std::unique_ptr<WorkerPool> workerPool_;
+    mutable Candidates candidates_;
 };
 } // namespace arbitration_graphs
 
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace arbitration_graphs {
+
+/*!
+ * \brief An InputSignal counts the revisions of an input behaviors can depend on (e.g. a part of the environment model)
+ *
+ * Call notifyChanged() whenever the input changes. Behaviors declare the inputs they depend on by
+ * Behavior::dependsOn(), which allows arbitrators to skip re-evaluating them as long as none of their inputs changed.
+ */
+class InputSignal {
+public:
+    using Ptr = std::shared_ptr<InputSignal>;
+    using ConstPtr = std::shared_ptr<const InputSignal>;
+
+    using Revision = std::size_t;
+
+    explicit InputSignal(const std::string& name = "InputSignal") : name_{name} {
+    }
+
+    void notifyChanged() {
+        revision_++;
+    }
+    Revision revision() const {
+        return revision_;
+    }
+
+    const std::string name_;
+
+private:
+    std::atomic<Revision> revision_{0};
+};
+
+//! The revisions of all inputs of a behavior, in the order they have been declared
+using InputRevisions = std::vector<InputSignal::Revision>;
+
+} // namespace arbitration_graphs
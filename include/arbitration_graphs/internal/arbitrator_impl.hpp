@@ -31,8 +31,8 @@ bool Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::isActive
 template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
 bool Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::isApplicable(const typename Option::Ptr& option,
                                                                                      const Time& time) const {
-    const bool isActiveAndCanBeContinued = isActive(option) && option->behavior_->checkCommitmentCondition(time);
-    return isActiveAndCanBeContinued || option->behavior_->checkInvocationCondition(time);
+    const bool isActiveAndCanBeContinued = isActive(option) && option->checkCommitmentCondition(time);
+    return isActiveAndCanBeContinued || option->checkInvocationCondition(time);
 }
 
 template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
@@ -50,19 +50,30 @@ std::size_t Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::g
 template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
 std::optional<SubCommandT> Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::getAndVerifyCommand(
     const typename Option::Ptr& option, const Time& time) const {
-    try {
-        const SubCommandT command = option->getCommand(time);
-
-        const VerificationResultT verificationResult = verifier_.analyze(time, command);
-        option->verificationResult_.cache(time, verificationResult);
+    const std::optional<SubCommandT> command = getOptionCommand(option, time);
+    if (!command) {
+        return std::nullopt;
+    }
 
-        // options explicitly flagged as fallback do not need to pass verification
-        if (verificationResult.isOk() || option->hasFlag(Option::Flags::FALLBACK)) {
+    try {
+        const VerificationResultT verificationResult = verify(time, command.value());
+        if (acceptVerificationResult(option, verificationResult, time)) {
             return command;
         }
-        // given option is applicable, but not safe
-        VLOG(1) << "Given option " << option->behavior_->name_ << " is applicable, but not safe";
-        VLOG(2) << "verification result: " << verificationResult;
+    } catch (const std::exception& e) {
+        // Catch all exceptions of the verifier and cache failed verification result
+        option->verificationResult_.cache(time, VerificationResultT{false});
+        VLOG(1) << "Verifying the command of option " << option->behavior_->name_
+                << " threw an exception: " << e.what();
+    }
+    return std::nullopt;
+}
+
+template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
+std::optional<SubCommandT> Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::getOptionCommand(
+    const typename Option::Ptr& option, const Time& time) const {
+    try {
+        return option->getCommand(time);
     } catch (VerificationError& e) {
         // given option is arbitrator without safe applicable option
         option->verificationResult_.reset();
@@ -77,10 +88,92 @@ std::optional<SubCommandT> Arbitrator<CommandT, SubCommandT, VerifierT, Verifica
     return std::nullopt;
 }
 
+template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
+bool Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::acceptVerificationResult(
+    const typename Option::Ptr& option, const VerificationResultT& verificationResult, const Time& time) const {
+    option->verificationResult_.cache(time, verificationResult);
+
+    // options explicitly flagged as fallback do not need to pass verification
+    if (verificationResult.isOk() || option->hasFlag(Option::Flags::FALLBACK)) {
+        return true;
+    }
+    // given option is applicable, but not safe
+    VLOG(1) << "Given option " << option->behavior_->name_ << " is applicable, but not safe";
+    VLOG(2) << "verification result: " << verificationResult;
+    return false;
+}
+
+template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
+VerificationResultT Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::verify(
+    const Time& time, const SubCommandT& command) const {
+    if (!verificationCache_) {
+        return verifier_.analyze(time, command);
+    }
+
+    if (const std::optional<VerificationResultT> cachedResult = verificationCache_->cached(command)) {
+        return cachedResult.value();
+    }
+    const VerificationResultT verificationResult = verifier_.analyze(time, command);
+    verificationCache_->cache(command, verificationResult);
+    return verificationResult;
+}
+
+template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
+std::vector<std::optional<VerificationResultT>> Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::
+    verifyBatch(const Time& time, const std::vector<SubCommandT>& commands) const {
+    std::vector<std::optional<VerificationResultT>> verificationResults;
+    verificationResults.reserve(commands.size());
+
+    if constexpr (verification::HasAnalyzeBatch<VerifierT, SubCommandT>::value) {
+        if (!verificationCache_) {
+            for (auto& verificationResult : verifier_.analyzeBatch(time, commands)) {
+                verificationResults.emplace_back(std::move(verificationResult));
+            }
+            return verificationResults;
+        }
+
+        // only analyze commands without cached result
+        std::vector<std::optional<VerificationResultT>> cachedResults;
+        cachedResults.reserve(commands.size());
+        std::vector<SubCommandT> uncachedCommands;
+        for (const auto& command : commands) {
+            cachedResults.push_back(verificationCache_->cached(command));
+            if (!cachedResults.back()) {
+                uncachedCommands.push_back(command);
+            }
+        }
+        const std::vector<VerificationResultT> uncachedResults =
+            uncachedCommands.empty() ? std::vector<VerificationResultT>{}
+                                     : verifier_.analyzeBatch(time, uncachedCommands);
+
+        auto uncachedResult = uncachedResults.begin();
+        for (std::size_t i = 0; i < commands.size(); ++i) {
+            if (cachedResults.at(i)) {
+                verificationResults.push_back(cachedResults.at(i).value());
+            } else {
+                verificationCache_->cache(commands.at(i), *uncachedResult);
+                verificationResults.push_back(*uncachedResult);
+                ++uncachedResult;
+            }
+        }
+    } else {
+        for (const auto& command : commands) {
+            // Catch exceptions per command, so that they only fail the option that returned it
+            try {
+                verificationResults.emplace_back(verify(time, command));
+            } catch (const std::exception& e) {
+                verificationResults.emplace_back(std::nullopt);
+                VLOG(1) << "Verifying a command of " << this->name_ << " threw an exception: " << e.what();
+            }
+        }
+    }
+    return verificationResults;
+}
+
 template <typename CommandT, typename SubCommandT, typename VerifierT, typename VerificationResultT>
 std::optional<SubCommandT> Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::
     getAndVerifyCommandFromActive(const Time& time) {
-    bool activeBehaviorCanBeContinued = activeBehavior_ && activeBehavior_->behavior_->checkCommitmentCondition(time);
+    bool activeBehaviorCanBeContinued = activeBehavior_ && activeBehavior_->checkCommitmentCondition(time);
 
     if (activeBehavior_ && !activeBehaviorCanBeContinued) {
         activeBehavior_->behavior_->loseControl(time);
@@ -47,6 +47,21 @@ YAML::Node Arbitrator<CommandT, SubCommandT, VerifierT, VerificationResultT>::Op
     if (hasFlag(Option::Flags::FALLBACK)) {
         node["flags"].push_back("FALLBACK");
     }
+    if (evaluationPeriod_) {
+        node["schedule"]["period"] = evaluationPeriod_->count();
+        // Age of the last actual evaluation, separately for the command and both conditions
+        if (lastCommandEvaluation_) {
+            node["schedule"]["lastEvaluation"]["command"] = Duration(time - *lastCommandEvaluation_).count();
+        }
+        if (lastInvocationConditionEvaluation_) {
+            node["schedule"]["lastEvaluation"]["invocationCondition"] =
+                Duration(time - *lastInvocationConditionEvaluation_).count();
+        }
+        if (lastCommitmentConditionEvaluation_) {
+            node["schedule"]["lastEvaluation"]["commitmentCondition"] =
+                Duration(time - *lastCommitmentConditionEvaluation_).count();
+        }
+    }
 
     return node;
 }
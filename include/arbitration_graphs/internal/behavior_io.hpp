@@ -39,6 +39,12 @@ YAML::Node Behavior<CommandT>::toYaml(const Time& time) const {
     node["name"] = name_;
     node["invocationCondition"] = checkInvocationCondition(time);
     node["commitmentCondition"] = checkCommitmentCondition(time);
+    for (const auto& input : inputs_) {
+        YAML::Node inputNode;
+        inputNode["name"] = input->name_;
+        inputNode["revision"] = input->revision();
+        node["inputs"].push_back(inputNode);
+    }
     return node;
 }
 
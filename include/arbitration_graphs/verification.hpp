@@ -1,6 +1,14 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <ostream>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
 
@@ -27,6 +35,82 @@ struct PlaceboVerifier {
     };
 };
 
+
+/*!
+ * @brief Detects whether a verifier provides a batch interface, i.e. a member function
+ *
+ * @code {.cpp}
+ * std::vector<ResultT> analyzeBatch(const Time& time, const std::vector<DataT>& data) const;
+ * @endcode
+ *
+ * returning one result per given command in the same order. Arbitrators evaluating multiple commands at once (e.g. the
+ * CostArbitrator) will then verify all of them in a single call instead of calling analyze() for each command.
+ */
+template <typename VerifierT, typename DataT, typename = void>
+struct HasAnalyzeBatch : std::false_type {};
+template <typename VerifierT, typename DataT>
+struct HasAnalyzeBatch<VerifierT,
+                       DataT,
+                       std::void_t<decltype(std::declval<const VerifierT&>().analyzeBatch(
+                           std::declval<const Time&>(), std::declval<const std::vector<DataT>&>()))>>
+        : std::true_type {};
+
+/*!
+ * @brief The ResultCache memoizes verification results of identical commands
+ *
+ * Commands are identified by a user-provided hash and equality function, results are only valid for a given
+ * environment revision. Bump the revision using setRevision() whenever anything the verifier depends on changes
+ * (e.g. the environment model or - for time dependent verifiers - the time), this invalidates all cached results.
+ *
+ * Pass a cache to Arbitrator::setVerificationCache() in order to verify identical commands only once. A single cache
+ * can be shared by multiple arbitrators (e.g. a whole arbitration graph), as long as they use the same verifier.
+ */
+template <typename DataT, typename ResultT>
+class ResultCache {
+public:
+    using Ptr = std::shared_ptr<ResultCache>;
+    using ConstPtr = std::shared_ptr<const ResultCache>;
+
+    using Hasher = std::function<std::size_t(const DataT&)>;
+    using KeyEqual = std::function<bool(const DataT&, const DataT&)>;
+    using Revision = std::size_t;
+
+    explicit ResultCache(const Hasher& hasher = std::hash<DataT>{}, const KeyEqual& keyEqual = std::equal_to<DataT>{})
+            : results_{0, hasher, keyEqual} {
+    }
+
+    /*!
+     * @brief Sets the current environment revision, clears all cached results if it changed
+     */
+    void setRevision(const Revision& revision) {
+        if (revision != revision_) {
+            results_.clear();
+            revision_ = revision;
+        }
+    }
+    Revision revision() const {
+        return revision_;
+    }
+
+    std::optional<ResultT> cached(const DataT& data) const {
+        const auto it = results_.find(data);
+        if (it == results_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+    void cache(const DataT& data, const ResultT& result) {
+        results_.insert_or_assign(data, result);
+    }
+    void reset() {
+        results_.clear();
+    }
+
+private:
+    Revision revision_{0};
+    std::unordered_map<DataT, ResultT, Hasher, KeyEqual> results_;
+};
+
 } // namespace arbitration_graphs::verification
 
 
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace arbitration_graphs {
+
+/*!
+ * @brief A fixed set of threads, which are started once and then reused for each call of forEachIndex()
+ *
+ * The calling thread works on the indices as well, so a pool of numThreads uses numThreads - 1 additional threads.
+ * Workers wait on a condition variable between calls, they don't spin. forEachIndex() must not be called from several
+ * threads at the same time, which is why each CostArbitrator owns its own pool.
+ */
+class WorkerPool {
+public:
+    explicit WorkerPool(const std::size_t numThreads) {
+        const std::size_t numWorkers = numThreads > 1 ? numThreads - 1 : 0;
+        workers_.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) {
+            workers_.emplace_back([this]() { run(); });
+        }
+    }
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        wakeUp_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t numThreads() const {
+        return workers_.size() + 1;
+    }
+
+    /*!
+     * @brief Calls function with each index in [0, count), distributed over the calling thread and the workers
+     *
+     * Returns once all indices have been processed. The first exception thrown by function is rethrown afterwards.
+     */
+    template <typename FunctionT>
+    void forEachIndex(const std::size_t count, const FunctionT& function) {
+        if (workers_.empty() || count <= 1) {
+            for (std::size_t index = 0; index < count; ++index) {
+                function(index);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            function_ = &function;
+            invoke_ = [](const void* function, const std::size_t index) {
+                (*static_cast<const FunctionT*>(function))(index);
+            };
+            count_ = count;
+            nextIndex_ = 0;
+            numBusyWorkers_ = workers_.size();
+            ++generation_;
+        }
+        wakeUp_.notify_all();
+
+        work();
+
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            done_.wait(lock, [this]() { return numBusyWorkers_ == 0; });
+            function_ = nullptr;
+            std::swap(exception, exception_);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    void run() {
+        std::uint64_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                wakeUp_.wait(lock, [this, &generation]() { return stop_ || generation_ != generation; });
+                if (stop_) {
+                    return;
+                }
+                generation = generation_;
+            }
+
+            work();
+
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (--numBusyWorkers_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    void work() {
+        for (std::size_t index = nextIndex_++; index < count_; index = nextIndex_++) {
+            try {
+                invoke_(function_, index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::condition_variable done_;
+    bool stop_{false};
+    std::uint64_t generation_{0};
+    std::size_t numBusyWorkers_{0};
+    std::exception_ptr exception_;
+
+    // The current task, written under mutex_ before the workers are woken up
+    const void* function_{nullptr};
+    void (*invoke_)(const void*, std::size_t){nullptr};
+    std::size_t count_{0};
+    std::atomic<std::size_t> nextIndex_{0};
+};
+
+} // namespace arbitration_graphs
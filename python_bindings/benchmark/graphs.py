@@ -0,0 +1,137 @@
+import itertools
+import time
+
+import arbitration_graphs as ag
+
+
+class ConstantBehavior(ag.Behavior):
+    """Cheapest possible Python behavior, so the measurements are dominated by the bindings."""
+
+    def __init__(self, name="constant", invocation=True, commitment=True):
+        super().__init__(name)
+        self.invocation = invocation
+        self.commitment = commitment
+
+    def get_command(self, time):
+        return self.name
+
+    def check_invocation_condition(self, time):
+        return self.invocation
+
+    def check_commitment_condition(self, time):
+        return self.commitment
+
+
+class SleepingBehavior(ConstantBehavior):
+    """Waits without holding the GIL, like a behavior calling into I/O or native code."""
+
+    def __init__(self, name="sleeping", duration=200e-6):
+        super().__init__(name)
+        self.duration = duration
+
+    def get_command(self, now):
+        time.sleep(self.duration)
+        return self.name
+
+
+class ConstantCostEstimator(ag.CostEstimator):
+    def __init__(self, cost=1.0):
+        super().__init__()
+        self.cost = cost
+
+    def estimate_cost(self, command, is_active):
+        return self.cost
+
+
+class BatchConstantCostEstimator(ConstantCostEstimator):
+    """Rates all commands of a cycle in a single call into Python."""
+
+    def estimate_costs(self, commands, is_active):
+        return [self.cost] * len(commands)
+
+
+class ConstantResult:
+    def __init__(self, is_ok=True):
+        self.ok = is_ok
+
+    def is_ok(self):
+        return self.ok
+
+
+class ConstantVerifier:
+    def __init__(self, is_ok=True):
+        self.result = ConstantResult(is_ok)
+
+    def analyze(self, time, command):
+        return self.result
+
+
+class ConstantBoolVerifier:
+    """Returns plain bools, which the bindings evaluate without calling back into Python."""
+
+    def __init__(self, is_ok=True):
+        self.ok = is_ok
+
+    def analyze(self, time, command):
+        return self.ok
+
+
+ARBITRATOR_TYPES = ["priority", "cost", "random"]
+
+
+def run_cycles(benchmark, arbitrator):
+    """Benchmarks get_command() on the given arbitrator, advancing the time with every cycle.
+
+    Options cache their commands per time, so reusing a single timestamp would only measure cache hits.
+    """
+    clock = itertools.count(time.time(), 0.01)
+    arbitrator.gain_control(next(clock))
+    benchmark(lambda: arbitrator.get_command(next(clock)))
+
+
+def make_arbitrator(arbitrator_type, width, name="root", verifier=None):
+    """Creates an arbitrator of the given type with width Python leaves, all of which are applicable."""
+    arguments = [name] if verifier is None else [name, verifier]
+
+    if arbitrator_type == "priority":
+        arbitrator = ag.PriorityArbitrator(*arguments)
+        for index in range(width):
+            arbitrator.add_option(
+                ConstantBehavior(f"{name}_{index}"),
+                ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+            )
+    elif arbitrator_type == "cost":
+        arbitrator = ag.CostArbitrator(*arguments)
+        for index in range(width):
+            arbitrator.add_option(
+                ConstantBehavior(f"{name}_{index}"),
+                ag.CostArbitrator.Option.Flags.NO_FLAGS,
+                ConstantCostEstimator(float(index)),
+            )
+    elif arbitrator_type == "random":
+        arbitrator = ag.RandomArbitrator(*arguments)
+        for index in range(width):
+            arbitrator.add_option(
+                ConstantBehavior(f"{name}_{index}"),
+                ag.RandomArbitrator.Option.Flags.NO_FLAGS,
+                1.0,
+            )
+    else:
+        raise ValueError(f"Unknown arbitrator type '{arbitrator_type}'")
+
+    return arbitrator
+
+
+def make_nested_graph(depth, width):
+    """Creates a chain of depth priority arbitrators, each with width Python leaves below the nested arbitrator."""
+    leaf = make_arbitrator("priority", width, f"level_{depth - 1}")
+    for level in reversed(range(depth - 1)):
+        parent = ag.PriorityArbitrator(f"level_{level}")
+        parent.add_option(leaf, ag.PriorityArbitrator.Option.Flags.NO_FLAGS)
+        for index in range(width):
+            parent.add_option(
+                ConstantBehavior(f"level_{level}_{index}"),
+                ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+            )
+        leaf = parent
+    return leaf
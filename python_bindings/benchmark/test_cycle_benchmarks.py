@@ -0,0 +1,76 @@
+"""Cycles per second of Python-built graphs depending on their width and depth.
+
+A cycle is a single get_command() call on the root, as issued by an application's control loop.
+"""
+
+import arbitration_graphs as ag
+import pytest
+
+from graphs import (
+    ARBITRATOR_TYPES,
+    ConstantBehavior,
+    ConstantBoolVerifier,
+    ConstantCostEstimator,
+    ConstantVerifier,
+    SleepingBehavior,
+    make_arbitrator,
+    make_nested_graph,
+    run_cycles,
+)
+
+WIDTHS = [1, 4, 16, 64]
+DEPTHS = [1, 2, 4, 8, 16]
+NUM_THREADS = [1, 2, 4, 8]
+
+
+@pytest.mark.parametrize("width", WIDTHS)
+@pytest.mark.parametrize("arbitrator_type", ARBITRATOR_TYPES)
+def test_width(benchmark, arbitrator_type, width):
+    benchmark.group = f"width {arbitrator_type}"
+    run_cycles(benchmark, make_arbitrator(arbitrator_type, width))
+
+
+@pytest.mark.parametrize("depth", DEPTHS)
+def test_depth(benchmark, depth):
+    benchmark.group = "depth"
+    run_cycles(benchmark, make_nested_graph(depth, width=1))
+
+
+VERIFIERS = {
+    "placebo": lambda: None,
+    "bool": ConstantBoolVerifier,
+    "python": ConstantVerifier,
+}
+
+
+@pytest.mark.parametrize("verifier", list(VERIFIERS))
+@pytest.mark.parametrize("arbitrator_type", ARBITRATOR_TYPES)
+def test_verification(benchmark, arbitrator_type, verifier):
+    """Verifiers returning plain bools should cost little more than the placebo verifier, unlike result objects."""
+    benchmark.group = f"verification {arbitrator_type}"
+    run_cycles(
+        benchmark,
+        make_arbitrator(arbitrator_type, width=16, verifier=VERIFIERS[verifier]()),
+    )
+
+
+@pytest.mark.parametrize("num_threads", NUM_THREADS)
+@pytest.mark.parametrize("behavior_type", ["constant", "sleeping"])
+def test_parallel(benchmark, behavior_type, num_threads):
+    """A cost arbitrator with 8 options evaluated by num_threads threads.
+
+    Sleeping behaviors release the GIL like behaviors waiting for I/O or native code, so these pay off from parallel
+    evaluation even with the GIL. Constant behaviors show the overhead of handing the options over to the threads.
+    """
+    benchmark.group = f"parallel {behavior_type}"
+    behavior_class = SleepingBehavior if behavior_type == "sleeping" else ConstantBehavior
+
+    arbitrator = ag.CostArbitrator("root")
+    arbitrator.num_threads = num_threads
+    for index in range(8):
+        arbitrator.add_option(
+            behavior_class(f"root_{index}"),
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            ConstantCostEstimator(float(index)),
+        )
+    run_cycles(benchmark, arbitrator)
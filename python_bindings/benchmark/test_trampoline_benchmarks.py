@@ -0,0 +1,81 @@
+"""Overhead of the individual trampolines, i.e. of C++ calling into Python.
+
+Each group compares calling the Python implementation directly with calling it the way C++ does, through the
+binding of the base class method. The difference is the per-call overhead of the trampoline.
+"""
+
+import time
+
+import arbitration_graphs as ag
+import pytest
+
+from graphs import (
+    BatchConstantCostEstimator,
+    ConstantBehavior,
+    ConstantCostEstimator,
+    ConstantVerifier,
+    make_arbitrator,
+    run_cycles,
+)
+
+BEHAVIOR_METHODS = [
+    "get_command",
+    "check_invocation_condition",
+    "check_commitment_condition",
+]
+
+
+@pytest.mark.parametrize("path", ["python", "trampoline"])
+@pytest.mark.parametrize("method", BEHAVIOR_METHODS)
+def test_behavior(benchmark, method, path):
+    benchmark.group = f"trampoline {method}"
+    behavior = ConstantBehavior()
+    now = time.time()
+
+    if path == "python":
+        benchmark(getattr(behavior, method), now)
+    else:
+        benchmark(getattr(ag.Behavior, method), behavior, now)
+
+
+@pytest.mark.parametrize("verifier", ["placebo", "python"])
+def test_analyze(benchmark, verifier):
+    """A single option arbitrator, so the difference between both is one analyze() and one is_ok() call."""
+    benchmark.group = "trampoline analyze"
+    arbitrator = make_arbitrator(
+        "priority",
+        width=1,
+        verifier=ConstantVerifier() if verifier == "python" else None,
+    )
+    run_cycles(benchmark, arbitrator)
+
+
+@pytest.mark.parametrize("options", [1, 2])
+def test_estimate_cost(benchmark, options):
+    """Each additional option adds one estimate_cost() call (plus the leaf's condition calls)."""
+    benchmark.group = "trampoline estimate_cost"
+    arbitrator = make_arbitrator("cost", width=options)
+    run_cycles(benchmark, arbitrator)
+
+
+def test_estimate_cost_python(benchmark):
+    """Baseline for test_estimate_cost: Calling the Python cost estimator directly."""
+    benchmark.group = "trampoline estimate_cost"
+    benchmark(ConstantCostEstimator().estimate_cost, "command", False)
+
+
+@pytest.mark.parametrize("hook", ["estimate_cost", "estimate_costs"])
+def test_estimate_costs_batch(benchmark, hook):
+    """16 options sharing one cost estimator, rated with 16 calls into Python or a single batch call."""
+    benchmark.group = "trampoline estimate_costs"
+    estimator_type = ConstantCostEstimator if hook == "estimate_cost" else BatchConstantCostEstimator
+    cost_estimator = estimator_type()
+
+    arbitrator = ag.CostArbitrator("root")
+    for index in range(16):
+        arbitrator.add_option(
+            ConstantBehavior(f"root_{index}"),
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            cost_estimator,
+        )
+    run_cycles(benchmark, arbitrator)
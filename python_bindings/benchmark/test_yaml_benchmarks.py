@@ -0,0 +1,22 @@
+"""Cost of converting a graph's state to Python dicts, natively versus parsing the emitted YAML string."""
+
+import time
+
+import pytest
+import yaml
+
+from graphs import make_nested_graph
+
+
+@pytest.mark.parametrize("conversion", ["native", "via_string"])
+def test_to_yaml(benchmark, conversion):
+    benchmark.group = "to_yaml"
+    graph = make_nested_graph(depth=4, width=4)
+    now = time.time()
+    graph.gain_control(now)
+    graph.get_command(now)
+
+    if conversion == "native":
+        benchmark(lambda: graph.to_yaml(now))
+    else:
+        benchmark(lambda: yaml.safe_load(graph.to_yaml_string(now)))
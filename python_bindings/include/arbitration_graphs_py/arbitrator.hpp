@@ -8,6 +8,7 @@
 #include <arbitration_graphs/behavior.hpp>
 
 #include "command_wrapper.hpp"
+#include "gil.hpp"
 #include "verification_wrapper.hpp"
 
 namespace arbitration_graphs_py {
@@ -27,10 +28,10 @@ inline void bindArbitrator(py::module& module) {
         arbitrator(module, "Arbitrator");
     arbitrator.def("add_option", &ArbitratorT::addOption, py::arg("behavior"), py::arg("flags"))
         .def("options", &ArbitratorT::options)
-        .def("check_invocation_condition", &ArbitratorT::checkInvocationCondition, py::arg("time"))
-        .def("check_commitment_condition", &ArbitratorT::checkCommitmentCondition, py::arg("time"))
-        .def("gain_control", &ArbitratorT::gainControl, py::arg("time"))
-        .def("lose_control", &ArbitratorT::loseControl, py::arg("time"))
+        .def("check_invocation_condition", &ArbitratorT::checkInvocationCondition, py::arg("time"), ReleaseGil())
+        .def("check_commitment_condition", &ArbitratorT::checkCommitmentCondition, py::arg("time"), ReleaseGil())
+        .def("gain_control", &ArbitratorT::gainControl, py::arg("time"), ReleaseGil())
+        .def("lose_control", &ArbitratorT::loseControl, py::arg("time"), ReleaseGil())
         .def("__repr__", [](const ArbitratorT& self) { return "<Arbitrator '" + self.name_ + "'>"; });
 
     py::class_<OptionT, std::shared_ptr<OptionT>> option(arbitrator, "Option");
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include <arbitration_graphs/behavior.hpp>
 #include <pybind11/pybind11.h>
 #include <yaml-cpp/yaml.h>
 
 #include "command_wrapper.hpp"
+#include "gil.hpp"
+#include "pickling.hpp"
 #include "yaml_helper.hpp"
 
 namespace arbitration_graphs_py {
@@ -13,6 +19,8 @@ namespace py = pybind11;
 namespace ag = arbitration_graphs;
 
 /// @brief A wrapper class (a.k.a. trampoline class) for the Behavior class to allow Python overrides
+/// @details The override macros acquire the GIL before calling into Python, so these methods may be called by
+///          arbitrators running with the GIL released.
 class PyBehavior : public ag::Behavior<CommandWrapper> {
 public:
     using BaseT = ag::Behavior<CommandWrapper>;
@@ -58,20 +66,57 @@ inline void bindBehavior(py::module& module) {
             .def(py::init<const std::string&>(), py::arg("name") = "Behavior")
             .def(
                 "get_command",
-                [](BehaviorT& self, const ag::Time& time) { return self.getCommand(time).value(); },
+                [](BehaviorT& self, const ag::Time& time) {
+                    CommandWrapper command;
+                    {
+                        // Accessing the command's value below requires the GIL again
+                        py::gil_scoped_release release;
+                        command = self.getCommand(time);
+                    }
+                    return command.value();
+                },
                 py::arg("time"))
-            .def("check_invocation_condition", &BehaviorT::checkInvocationCondition, py::arg("time"))
-            .def("check_commitment_condition", &BehaviorT::checkCommitmentCondition, py::arg("time"))
-            .def("gain_control", &BehaviorT::gainControl, py::arg("time"))
-            .def("lose_control", &BehaviorT::loseControl, py::arg("time"))
-            .def("to_str", &BehaviorT::to_str, py::arg("time"), py::arg("prefix") = "", py::arg("suffix") = "")
+            .def("check_invocation_condition",
+                 &BehaviorT::checkInvocationCondition,
+                 py::arg("time"),
+                 ReleaseGil())
+            .def("check_commitment_condition",
+                 &BehaviorT::checkCommitmentCondition,
+                 py::arg("time"),
+                 ReleaseGil())
+            .def("gain_control", &BehaviorT::gainControl, py::arg("time"), ReleaseGil())
+            .def("lose_control", &BehaviorT::loseControl, py::arg("time"), ReleaseGil())
+            .def("to_str",
+                 &BehaviorT::to_str,
+                 py::arg("time"),
+                 py::arg("prefix") = "",
+                 py::arg("suffix") = "",
+                 ReleaseGil())
             .def(
                 "to_yaml",
                 [](const BehaviorT& self, const ag::Time& time) {
                     return yaml_helper::toYamlAsPythonObject(self, time);
                 },
                 py::arg("time"))
+            .def(
+                "to_yaml_string",
+                [](const BehaviorT& self, const ag::Time& time) { return yaml_helper::toYamlString(self, time); },
+                py::arg("time"))
             .def_readonly("name", &BehaviorT::name_)
+            .def(py::pickle(
+                [](const py::object& self) {
+                    const auto& behavior = self.cast<const BehaviorT&>();
+                    if (dynamic_cast<const PyBehavior*>(&behavior) == nullptr) {
+                        throw py::type_error("Native behavior '" + behavior.name_ + "' can't be pickled");
+                    }
+                    return py::make_tuple(behavior.name_, pickling::instanceDict(self));
+                },
+                [](const py::tuple& state) {
+                    if (state.size() != 2) {
+                        throw std::runtime_error("Invalid behavior state!");
+                    }
+                    return std::make_pair(new PyBehavior(state[0].cast<std::string>()), state[1].cast<py::dict>());
+                }))
             .def("__repr__", [](const BehaviorT& self) { return "<Behavior '" + self.name_ + "'>"; });
 }
 
@@ -1,13 +1,103 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <string>
 
+#include <pybind11/buffer_info.h>
 #include <pybind11/pybind11.h>
 
+#include "gil.hpp"
+
 namespace arbitration_graphs_py {
 
 namespace py = pybind11;
 
+/// @brief Read-only view on the numerical data of a command implementing the buffer protocol, e.g. a NumPy array.
+/// @details The view points directly into the memory of the Python object, nothing is copied. This allows native
+///          verifiers and cost estimators to evaluate Python-produced commands without the GIL. The data must not be
+///          modified from Python while an arbitrator is running.
+///          Only float64 buffers are supported.
+class CommandArray {
+public:
+    using Ptr = std::shared_ptr<const CommandArray>;
+
+    /// @brief Creates a view on the given object, requires the GIL.
+    /// @return The view or nullptr, if the object doesn't expose a float64 buffer.
+    static Ptr fromObject(const py::object& object) {
+        if (!PyObject_CheckBuffer(object.ptr())) {
+            return nullptr;
+        }
+        py::buffer_info info;
+        try {
+            info = py::reinterpret_borrow<py::buffer>(object).request();
+        } catch (const py::error_already_set&) {
+            // Some objects claim to support the buffer protocol, but fail to export a strided buffer
+            return nullptr;
+        }
+        if (info.format != py::format_descriptor<double>::format() || info.itemsize != sizeof(double)) {
+            return nullptr;
+        }
+
+        // Releasing the buffer (in the buffer_info destructor) requires the GIL
+        return {new CommandArray(std::move(info)), [](CommandArray* array) {
+                    if (Py_IsInitialized() == 0) {
+                        return;
+                    }
+                    py::gil_scoped_acquire gil;
+                    delete array;
+                }};
+    }
+
+    const double* data() const {
+        return static_cast<const double*>(info_.ptr);
+    }
+    std::size_t ndim() const {
+        return info_.shape.size();
+    }
+    py::ssize_t shape(std::size_t dim) const {
+        return info_.shape.at(dim);
+    }
+    /// @brief Total number of elements
+    py::ssize_t size() const {
+        return info_.size;
+    }
+    /// @brief True if the elements are stored contiguously in row-major order, i.e. data() can be read linearly.
+    bool isContiguous() const {
+        py::ssize_t expectedStride = sizeof(double);
+        for (std::size_t dim = ndim(); dim-- > 0;) {
+            if (info_.shape[dim] > 1 && info_.strides[dim] != expectedStride) {
+                return false;
+            }
+            expectedStride *= info_.shape[dim];
+        }
+        return true;
+    }
+
+    /// @brief Element access respecting the strides, one index per dimension.
+    template <typename... Indices>
+    double operator()(Indices... indices) const {
+        const std::array<py::ssize_t, sizeof...(Indices)> index{static_cast<py::ssize_t>(indices)...};
+        if (index.size() != ndim()) {
+            throw std::out_of_range("CommandArray has " + std::to_string(ndim()) + " dimensions");
+        }
+        py::ssize_t offset = 0;
+        for (std::size_t dim = 0; dim < index.size(); ++dim) {
+            offset += index[dim] * info_.strides[dim];
+        }
+        return *reinterpret_cast<const double*>( // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<const char*>(info_.ptr) + offset);
+    }
+
+private:
+    explicit CommandArray(py::buffer_info info) : info_{std::move(info)} {
+    }
+
+    py::buffer_info info_;
+};
+
 /// @brief A thin wrapper class for the Command class allowing the instantiation of the arbitration graph classes.
 /// @details To work around the issue of the arbitration graph library being a highly templated C++ library, we use this
 ///          wrapper class to allow the instantiation of the arbitration graph classes with arbitrary Python. This way,
@@ -15,10 +105,15 @@ namespace py = pybind11;
 ///          compile time. This of course comes at the price of potential runtime errors if the Python objects do not
 ///          provide the expected interfaces. In the case of the Command class, a pure data class, this
 ///          shouldn't lead to issues though.
+///          Commands are passed around by the arbitrators while the GIL is released, which is safe as long as only the
+///          shared pointer is copied. Accessing the value requires holding the GIL.
+///          Commands exposing float64 data via the buffer protocol (e.g. NumPy arrays) can additionally be read from
+///          C++ without the GIL using array().
 class CommandWrapper {
 public:
     CommandWrapper() = default;
-    explicit CommandWrapper(py::object command) : command_{std::make_shared<py::object>(std::move(command))} {
+    explicit CommandWrapper(py::object command)
+            : array_{CommandArray::fromObject(command)}, command_{makeSharedObject(std::move(command))} {
     }
 
     py::object value() const {
@@ -28,7 +123,14 @@ public:
         return *command_;
     }
 
+    /// @brief Zero-copy view on the command's data, nullptr if the command isn't a float64 buffer.
+    /// @details Does not require the GIL.
+    const CommandArray* array() const {
+        return array_.get();
+    }
+
 private:
+    CommandArray::Ptr array_;
     std::shared_ptr<py::object> command_;
 };
 
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include <yaml-cpp/yaml.h>
 
 #include <arbitration_graphs/arbitrator.hpp>
@@ -8,6 +14,7 @@
 #include <arbitration_graphs/cost_arbitrator.hpp>
 
 #include "command_wrapper.hpp"
+#include "pickling.hpp"
 #include "verification_wrapper.hpp"
 #include "yaml_helper.hpp"
 
@@ -17,14 +24,58 @@ namespace py = pybind11;
 namespace ag = arbitration_graphs;
 
 /// @brief A wrapper class (a.k.a. trampoline class) for the CostEstimator class to allow Python overrides.
+/// @details Like the PyBehavior, the override macro acquires the GIL for the call into Python.
+///          Python cost estimators may implement estimate_costs(commands, is_active) to rate all commands of a cycle
+///          in a single call, e.g. vectorized with NumPy. It receives two lists and returns a sequence or float64 array
+///          with one cost per command. Otherwise, estimate_cost() is called for each command.
 class PyCostEstimator : public ag::CostEstimator<CommandWrapper> {
 public:
+    using BaseT = ag::CostEstimator<CommandWrapper>;
+
     // NOLINTBEGIN(readability-function-size)
     double estimateCost(const CommandWrapper& command, const bool isActive) override {
         PYBIND11_OVERRIDE_PURE_NAME(
             double, CostEstimator<CommandWrapper>, "estimate_cost", estimateCost, command, isActive);
     }
     // NOLINTEND(readability-function-size)
+
+    std::vector<double> estimateCosts(const CommandRefs& commands, const std::vector<bool>& isActive) override {
+        {
+            py::gil_scoped_acquire gil;
+            py::function override = py::get_override(static_cast<const BaseT*>(this), "estimate_costs");
+            if (override) {
+                py::list pyCommands(commands.size());
+                py::list pyIsActive(isActive.size());
+                for (std::size_t i = 0; i < commands.size(); ++i) {
+                    pyCommands[i] = commands[i].get().value();
+                    pyIsActive[i] = py::bool_(isActive[i]);
+                }
+                return toCosts(override(pyCommands, pyIsActive), commands.size());
+            }
+        }
+        // Without a batch override, the base class calls estimateCost() for each command
+        return BaseT::estimateCosts(commands, isActive);
+    }
+
+private:
+    /// @brief Converts the result of estimate_costs(), reading float64 arrays directly from their buffer.
+    static std::vector<double> toCosts(const py::object& result, std::size_t expectedSize) {
+        std::vector<double> costs;
+        if (const CommandArray::Ptr array = CommandArray::fromObject(result); array && array->ndim() == 1) {
+            costs.reserve(array->shape(0));
+            for (py::ssize_t i = 0; i < array->shape(0); ++i) {
+                costs.push_back((*array)(i));
+            }
+        } else {
+            costs = result.cast<std::vector<double>>();
+        }
+
+        if (costs.size() != expectedSize) {
+            throw py::value_error("estimate_costs() returned " + std::to_string(costs.size()) + " costs for " +
+                                  std::to_string(expectedSize) + " commands");
+        }
+        return costs;
+    }
 };
 
 inline void bindCostArbitrator(py::module& module) {
@@ -43,7 +94,20 @@ inline void bindCostArbitrator(py::module& module) {
     using FlagsT = typename OptionT::FlagsT;
 
     py::class_<CostEstimatorT, PyCostEstimator, std::shared_ptr<CostEstimatorT>>(module, "CostEstimator")
-        .def(py::init<>());
+        .def(py::init<>())
+        .def(py::pickle(
+            [](const py::object& self) {
+                if (dynamic_cast<const PyCostEstimator*>(&self.cast<const CostEstimatorT&>()) == nullptr) {
+                    throw py::type_error("Native cost estimators can't be pickled");
+                }
+                return py::make_tuple(pickling::instanceDict(self));
+            },
+            [](const py::tuple& state) {
+                if (state.size() != 1) {
+                    throw std::runtime_error("Invalid cost estimator state!");
+                }
+                return std::make_pair(new PyCostEstimator(), state[0].cast<py::dict>());
+            }));
 
     py::class_<CostArbitratorT, ArbitratorT, std::shared_ptr<CostArbitratorT>> costArbitrator(module, "CostArbitrator");
     costArbitrator
@@ -52,10 +116,12 @@ inline void bindCostArbitrator(py::module& module) {
              py::arg("verifier") = VerifierWrapper())
         .def(
             "add_option", &CostArbitratorT::addOption, py::arg("behavior"), py::arg("flags"), py::arg("cost_estimator"))
+        .def_property("num_threads", &CostArbitratorT::numThreads, &CostArbitratorT::setNumThreads)
         .def(
             "to_yaml",
             [](const CostArbitratorT& self, const Time& time) { return yaml_helper::toYamlAsPythonObject(self, time); },
             py::arg("time"))
+        .def(pickling::pickleArbitrator<CostArbitratorT>())
         .def("__repr__", [](const CostArbitratorT& self) { return "<CostArbitrator '" + self.name_ + "'>"; });
 
     py::class_<OptionT, ArbitratorOptionT, std::shared_ptr<OptionT>> option(costArbitrator, "Option");
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+
+#include <pybind11/pybind11.h>
+
+namespace arbitration_graphs_py {
+
+namespace py = pybind11;
+
+/// @brief Call guard releasing the GIL while a bound C++ function runs.
+/// @details Used for all calls that traverse (parts of) an arbitration graph. Native C++ subtrees then run without the
+///          GIL, allowing other Python threads to make progress. Python code is only entered at the PyBehavior,
+///          PyCostEstimator and VerifierWrapper call sites, which re-acquire the GIL for the duration of the call.
+using ReleaseGil = py::call_guard<py::gil_scoped_release>;
+
+/// @brief Shares a Python object between C++ objects which may be copied and destroyed without holding the GIL.
+/// @details Copying the shared pointer doesn't touch the Python reference count. Only dropping the last copy does, so
+///          the deleter re-acquires the GIL for that. Once the interpreter is finalized, the reference is leaked
+///          instead.
+inline std::shared_ptr<py::object> makeSharedObject(py::object object) {
+    return {new py::object(std::move(object)), [](py::object* sharedObject) {
+                if (Py_IsInitialized() == 0) {
+                    sharedObject->release();
+                    delete sharedObject;
+                    return;
+                }
+                py::gil_scoped_acquire gil;
+                delete sharedObject;
+            }};
+}
+
+} // namespace arbitration_graphs_py
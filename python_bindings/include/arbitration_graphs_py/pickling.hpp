@@ -0,0 +1,239 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <arbitration_graphs/behavior.hpp>
+#include <arbitration_graphs/cost_arbitrator.hpp>
+#include <arbitration_graphs/types.hpp>
+#include <pybind11/pybind11.h>
+
+#include "command_wrapper.hpp"
+#include "verification_wrapper.hpp"
+
+namespace arbitration_graphs_py::pickling {
+
+namespace py = pybind11;
+namespace ag = arbitration_graphs;
+
+/// @brief Version of the encoded arbitrator state, bumped whenever its layout changes.
+/// @details Since version 2, all values are encoded in little-endian byte order, independent of the host.
+constexpr std::uint8_t StateVersion = 2;
+
+/// @brief The unsigned integer type with the size of T, whose bits are encoded byte by byte.
+template <typename T>
+using EncodedBitsT =
+    std::conditional_t<sizeof(T) == 1,
+                       std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2,
+                                          std::uint16_t,
+                                          std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+template <typename T>
+constexpr void checkEncodable() {
+    static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>);
+    static_assert(sizeof(T) <= sizeof(std::uint64_t));
+    static_assert(!std::is_floating_point_v<T> || std::numeric_limits<T>::is_iec559);
+}
+
+/// @brief Appends scalar values to a compact binary buffer, in little-endian byte order.
+class StateWriter {
+public:
+    template <typename T>
+    void write(const T& value) {
+        checkEncodable<T>();
+        EncodedBitsT<T> bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+            buffer_.push_back(static_cast<char>((bits >> (8 * byte)) & 0xFFU));
+        }
+    }
+
+    py::bytes bytes() const {
+        return {buffer_};
+    }
+
+private:
+    std::string buffer_;
+};
+
+/// @brief Reads the values written by a StateWriter in the same order.
+/// @throws py::value_error if the buffer is truncated or has trailing data.
+class StateReader {
+public:
+    explicit StateReader(const py::bytes& bytes) : buffer_{bytes} {
+    }
+
+    template <typename T>
+    T read() {
+        checkEncodable<T>();
+        if (position_ + sizeof(T) > buffer_.size()) {
+            throw py::value_error("Encoded arbitrator state is truncated");
+        }
+        EncodedBitsT<T> bits{0};
+        for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+            const auto encodedByte =
+                static_cast<EncodedBitsT<T>>(static_cast<unsigned char>(buffer_[position_ + byte]));
+            bits = static_cast<EncodedBitsT<T>>(bits | (encodedByte << (8 * byte)));
+        }
+        position_ += sizeof(T);
+
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+
+    void expectEnd() const {
+        if (position_ != buffer_.size()) {
+            throw py::value_error("Encoded arbitrator state has unexpected trailing data");
+        }
+    }
+
+private:
+    std::string buffer_;
+    std::size_t position_{0};
+};
+
+/// @brief The attributes of Python subclasses, which have to be pickled along with the C++ state.
+inline py::dict instanceDict(const py::object& self) {
+    if (py::hasattr(self, "__dict__")) {
+        return self.attr("__dict__");
+    }
+    return {};
+}
+
+template <typename OptionT, typename = void>
+struct HasWeight : std::false_type {};
+template <typename OptionT>
+struct HasWeight<OptionT, std::void_t<decltype(std::declval<OptionT>().weight_)>> : std::true_type {};
+
+template <typename OptionT, typename = void>
+struct HasCostEstimator : std::false_type {};
+template <typename OptionT>
+struct HasCostEstimator<OptionT, std::void_t<decltype(std::declval<OptionT>().costEstimator_)>> : std::true_type {};
+
+/// @brief Captures the structure and state of an arbitrator for pickling.
+/// @details The state is a tuple of (name, verifier, behaviors, cost estimators, encoded state, __dict__).
+///          Behaviors, cost estimators and the verifier are Python objects and pickled by pickle itself. This way,
+///          nested arbitrators are pickled recursively and instances shared within a graph stay shared.
+///          All scalar per-node state (flags, weights, evaluation periods, last costs, active option, number of
+///          threads) is packed into a compact, little-endian binary encoding. Transient caches are not pickled, they
+///          are rebuilt in the next cycle.
+template <typename ArbitratorT>
+py::tuple getArbitratorState(const py::object& self) {
+    using OptionT = typename ArbitratorT::Option;
+
+    const auto& arbitrator = self.cast<const ArbitratorT&>();
+
+    StateWriter writer;
+    writer.write(StateVersion);
+
+    const auto options = arbitrator.options();
+    writer.write(static_cast<std::uint32_t>(options.size()));
+
+    py::list behaviors;
+    py::list costEstimators;
+    for (const auto& optionBase : options) {
+        const auto option = std::dynamic_pointer_cast<const OptionT>(optionBase);
+        behaviors.append(py::cast(option->behavior_));
+
+        writer.write(static_cast<std::uint32_t>(option->flags_));
+        writer.write(static_cast<std::uint8_t>(option->evaluationPeriod_.has_value()));
+        writer.write(option->evaluationPeriod_.value_or(ag::Duration::zero()).count());
+        if constexpr (HasWeight<OptionT>::value) {
+            writer.write(option->weight_);
+        }
+        if constexpr (HasCostEstimator<OptionT>::value) {
+            costEstimators.append(py::cast(option->costEstimator_));
+            writer.write(static_cast<std::uint8_t>(option->last_estimated_cost_.has_value()));
+            writer.write(option->last_estimated_cost_.value_or(0.));
+        }
+    }
+
+    const std::optional<std::size_t> activeOptionIndex = arbitrator.activeOptionIndex();
+    writer.write(activeOptionIndex ? static_cast<std::int64_t>(*activeOptionIndex) : std::int64_t{-1});
+    if constexpr (HasCostEstimator<OptionT>::value) {
+        writer.write(static_cast<std::uint64_t>(arbitrator.numThreads()));
+    }
+
+    return py::make_tuple(
+        arbitrator.name_, arbitrator.verifier().value(), behaviors, costEstimators, writer.bytes(), instanceDict(self));
+}
+
+/// @brief Rebuilds an arbitrator from the state returned by getArbitratorState().
+template <typename ArbitratorT>
+std::pair<ArbitratorT*, py::dict> setArbitratorState(const py::tuple& state) {
+    using OptionT = typename ArbitratorT::Option;
+    using BehaviorPtr = typename ag::Behavior<CommandWrapper>::Ptr;
+    using FlagsT = typename OptionT::FlagsT;
+
+    if (state.size() != 6) {
+        throw std::runtime_error("Invalid arbitrator state!");
+    }
+
+    auto arbitrator = std::make_unique<ArbitratorT>(state[0].cast<std::string>(), VerifierWrapper(state[1]));
+    const auto behaviors = state[2].cast<py::list>();
+    const auto costEstimators = state[3].cast<py::list>();
+
+    StateReader reader(state[4].cast<py::bytes>());
+    if (reader.read<std::uint8_t>() != StateVersion) {
+        throw py::value_error("Arbitrator state was pickled by an incompatible version");
+    }
+
+    const auto numOptions = reader.read<std::uint32_t>();
+    if (numOptions != behaviors.size()) {
+        throw py::value_error("Encoded arbitrator state doesn't match the number of behaviors");
+    }
+    for (std::size_t i = 0; i < numOptions; ++i) {
+        const auto behavior = behaviors[i].cast<BehaviorPtr>();
+        const auto flags = static_cast<FlagsT>(reader.read<std::uint32_t>());
+        const bool hasEvaluationPeriod = reader.read<std::uint8_t>() != 0;
+        const ag::Duration evaluationPeriod{reader.read<double>()};
+
+        if constexpr (HasWeight<OptionT>::value) {
+            arbitrator->addOption(behavior, flags, reader.read<double>());
+        } else if constexpr (HasCostEstimator<OptionT>::value) {
+            arbitrator->addOption(
+                behavior, flags, costEstimators[i].cast<typename ag::CostEstimator<CommandWrapper>::Ptr>());
+            const bool hasLastEstimatedCost = reader.read<std::uint8_t>() != 0;
+            const auto lastEstimatedCost = reader.read<double>();
+            if (hasLastEstimatedCost) {
+                std::dynamic_pointer_cast<OptionT>(arbitrator->options().back())->last_estimated_cost_ =
+                    lastEstimatedCost;
+            }
+        } else {
+            arbitrator->addOption(behavior, flags);
+        }
+        if (hasEvaluationPeriod) {
+            arbitrator->setEvaluationPeriod(i, evaluationPeriod);
+        }
+    }
+
+    const auto activeOptionIndex = reader.read<std::int64_t>();
+    if (activeOptionIndex >= 0) {
+        arbitrator->restoreActiveOption(static_cast<std::size_t>(activeOptionIndex));
+    }
+    if constexpr (HasCostEstimator<OptionT>::value) {
+        arbitrator->setNumThreads(reader.read<std::uint64_t>());
+    }
+    reader.expectEnd();
+
+    return {arbitrator.release(), state[5].cast<py::dict>()};
+}
+
+/// @brief Pickling support for the arbitrator classes, see getArbitratorState().
+template <typename ArbitratorT>
+auto pickleArbitrator() {
+    return py::pickle([](const py::object& self) { return getArbitratorState<ArbitratorT>(self); },
+                      [](const py::tuple& state) { return setArbitratorState<ArbitratorT>(state); });
+}
+
+} // namespace arbitration_graphs_py::pickling
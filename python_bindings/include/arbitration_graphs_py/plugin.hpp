@@ -0,0 +1,187 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <dlfcn.h>
+
+#include <arbitration_graphs/behavior.hpp>
+#include <arbitration_graphs/cost_arbitrator.hpp>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "command_wrapper.hpp"
+#include "verification_wrapper.hpp"
+
+namespace arbitration_graphs_py {
+
+namespace py = pybind11;
+namespace ag = arbitration_graphs;
+
+/// @brief Version of the plugin interface, bumped whenever the PluginRegistry or the wrapper types change.
+/// @details Plugins share C++ objects with the bindings, so they have to be compiled against the same headers.
+constexpr int PluginApiVersion = 2;
+
+/// @brief Collects the factories a plugin provides for native behaviors, verifiers and cost estimators.
+/// @details Each factory receives the keyword arguments passed to the respective Plugin.create_*() method in Python.
+///          Factories are called with the GIL held, so this is the place to construct the Python command objects a
+///          native behavior returns. Everything called by the arbitrators later on runs without the GIL.
+class PluginRegistry {
+public:
+    using BehaviorPtr = std::shared_ptr<ag::Behavior<CommandWrapper>>;
+    using VerifierPtr = NativeVerifier::Ptr;
+    using CostEstimatorPtr = std::shared_ptr<ag::CostEstimator<CommandWrapper>>;
+
+    using BehaviorFactory = std::function<BehaviorPtr(const py::kwargs&)>;
+    using VerifierFactory = std::function<VerifierPtr(const py::kwargs&)>;
+    using CostEstimatorFactory = std::function<CostEstimatorPtr(const py::kwargs&)>;
+
+    void addBehavior(const std::string& type, BehaviorFactory factory) {
+        behaviors_[type] = std::move(factory);
+    }
+    void addVerifier(const std::string& type, VerifierFactory factory) {
+        verifiers_[type] = std::move(factory);
+    }
+    void addCostEstimator(const std::string& type, CostEstimatorFactory factory) {
+        costEstimators_[type] = std::move(factory);
+    }
+
+    BehaviorPtr createBehavior(const std::string& type, const py::kwargs& parameters) const {
+        return find(behaviors_, type, "behavior")(parameters);
+    }
+    VerifierPtr createVerifier(const std::string& type, const py::kwargs& parameters) const {
+        return find(verifiers_, type, "verifier")(parameters);
+    }
+    CostEstimatorPtr createCostEstimator(const std::string& type, const py::kwargs& parameters) const {
+        return find(costEstimators_, type, "cost estimator")(parameters);
+    }
+
+    std::vector<std::string> behaviorTypes() const {
+        return keys(behaviors_);
+    }
+    std::vector<std::string> verifierTypes() const {
+        return keys(verifiers_);
+    }
+    std::vector<std::string> costEstimatorTypes() const {
+        return keys(costEstimators_);
+    }
+
+private:
+    template <typename FactoryT>
+    static const FactoryT& find(const std::map<std::string, FactoryT>& factories,
+                                const std::string& type,
+                                const std::string& kind) {
+        auto it = factories.find(type);
+        if (it == factories.end()) {
+            throw py::key_error("Plugin does not provide a " + kind + " of type '" + type + "'");
+        }
+        return it->second;
+    }
+
+    template <typename FactoryT>
+    static std::vector<std::string> keys(const std::map<std::string, FactoryT>& factories) {
+        std::vector<std::string> types;
+        types.reserve(factories.size());
+        for (const auto& [type, factory] : factories) {
+            types.push_back(type);
+        }
+        return types;
+    }
+
+    std::map<std::string, BehaviorFactory> behaviors_;
+    std::map<std::string, VerifierFactory> verifiers_;
+    std::map<std::string, CostEstimatorFactory> costEstimators_;
+};
+
+/// @brief Defines the entry point of a plugin shared library.
+/// @details Usage:
+///          @code
+///          ARBITRATION_GRAPHS_PY_PLUGIN(registry) {
+///              registry.addBehavior("MyBehavior", [](const py::kwargs& parameters) { ... });
+///          }
+///          @endcode
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define ARBITRATION_GRAPHS_PY_PLUGIN(registry)                                                                         \
+    extern "C" PYBIND11_EXPORT int arbitration_graphs_py_plugin_api_version() {                                        \
+        return ::arbitration_graphs_py::PluginApiVersion;                                                              \
+    }                                                                                                                  \
+    extern "C" PYBIND11_EXPORT void arbitration_graphs_py_register_plugin(                                             \
+        ::arbitration_graphs_py::PluginRegistry& registry)
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+/// @brief A shared library providing native behaviors, verifiers and cost estimators.
+/// @details The library is never unloaded: The objects it creates may outlive the Plugin instance and their code (e.g.
+///          the destructors of commands created by it) has to stay available until the interpreter shuts down.
+class Plugin {
+public:
+    using Ptr = std::shared_ptr<Plugin>;
+
+    explicit Plugin(std::string path) : path_{std::move(path)} {
+        // NOLINTNEXTLINE(hicpp-signed-bitwise)
+        void* library = dlopen(path_.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (library == nullptr) {
+            throw py::import_error("Failed to load plugin '" + path_ + "': " + dlerror());
+        }
+
+        using ApiVersionFunction = int (*)();
+        using RegisterFunction = void (*)(PluginRegistry&);
+        auto apiVersion = reinterpret_cast<ApiVersionFunction>( // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dlsym(library, "arbitration_graphs_py_plugin_api_version"));
+        auto registerPlugin = reinterpret_cast<RegisterFunction>( // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dlsym(library, "arbitration_graphs_py_register_plugin"));
+        if (apiVersion == nullptr || registerPlugin == nullptr) {
+            throw py::import_error("'" + path_ + "' is not an arbitration graphs plugin");
+        }
+        if (apiVersion() != PluginApiVersion) {
+            throw py::import_error("Plugin '" + path_ + "' was built for plugin API version " +
+                                   std::to_string(apiVersion()) + ", expected " + std::to_string(PluginApiVersion));
+        }
+
+        registerPlugin(registry_);
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+    const PluginRegistry& registry() const {
+        return registry_;
+    }
+
+private:
+    std::string path_;
+    PluginRegistry registry_;
+};
+
+inline void bindPlugin(py::module& module) {
+    py::class_<Plugin, Plugin::Ptr>(module, "Plugin")
+        .def(py::init<std::string>(), py::arg("path"))
+        .def_property_readonly("path", &Plugin::path)
+        .def("behavior_types", [](const Plugin& self) { return self.registry().behaviorTypes(); })
+        .def("verifier_types", [](const Plugin& self) { return self.registry().verifierTypes(); })
+        .def("cost_estimator_types", [](const Plugin& self) { return self.registry().costEstimatorTypes(); })
+        .def(
+            "create_behavior",
+            [](const Plugin& self, const std::string& type, const py::kwargs& parameters) {
+                return self.registry().createBehavior(type, parameters);
+            },
+            py::arg("type"))
+        .def(
+            "create_verifier",
+            [](const Plugin& self, const std::string& type, const py::kwargs& parameters) {
+                return self.registry().createVerifier(type, parameters);
+            },
+            py::arg("type"))
+        .def(
+            "create_cost_estimator",
+            [](const Plugin& self, const std::string& type, const py::kwargs& parameters) {
+                return self.registry().createCostEstimator(type, parameters);
+            },
+            py::arg("type"))
+        .def("__repr__", [](const Plugin& self) { return "<Plugin '" + self.path() + "'>"; });
+}
+
+} // namespace arbitration_graphs_py
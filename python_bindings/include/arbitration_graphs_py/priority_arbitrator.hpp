@@ -8,6 +8,7 @@
 #include <arbitration_graphs/priority_arbitrator.hpp>
 
 #include "command_wrapper.hpp"
+#include "pickling.hpp"
 #include "verification_wrapper.hpp"
 #include "yaml_helper.hpp"
 
@@ -43,6 +44,7 @@ inline void bindPriorityArbitrator(py::module& module) {
                 return yaml_helper::toYamlAsPythonObject(self, time);
             },
             py::arg("time"))
+        .def(pickling::pickleArbitrator<PriorityArbitratorT>())
         .def("__repr__", [](const PriorityArbitratorT& self) { return "<PriorityArbitrator '" + self.name_ + "'>"; });
 
     py::class_<OptionT, ArbitratorOptionT, std::shared_ptr<OptionT>> option(priorityArbitrator, "Option");
@@ -8,6 +8,7 @@
 #include <arbitration_graphs/random_arbitrator.hpp>
 
 #include "command_wrapper.hpp"
+#include "pickling.hpp"
 #include "verification_wrapper.hpp"
 #include "yaml_helper.hpp"
 
@@ -43,6 +44,7 @@ inline void bindRandomArbitrator(py::module& module) {
                 return yaml_helper::toYamlAsPythonObject(self, time);
             },
             py::arg("time"))
+        .def(pickling::pickleArbitrator<RandomArbitratorT>())
         .def("__repr__", [](const RandomArbitratorT& self) { return "<RandomArbitrator '" + self.name_ + "'>"; });
 
     py::class_<OptionT, ArbitratorOptionT, std::shared_ptr<OptionT>> option(randomArbitrator, "Option");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <ostream>
 #include <stdexcept>
 
@@ -7,6 +9,7 @@
 #include <pybind11/pybind11.h>
 
 #include "command_wrapper.hpp"
+#include "gil.hpp"
 
 namespace arbitration_graphs_py {
 
@@ -14,42 +17,77 @@ namespace py = pybind11;
 using namespace pybind11::literals;
 
 
+/// @brief Base class for verification results implemented in C++, e.g. by native plugin verifiers.
+/// @details The VerificationResultWrapper recognizes these and evaluates isOk() without calling into Python.
+class NativeVerificationResult {
+public:
+    using Ptr = std::shared_ptr<NativeVerificationResult>;
+    using ConstPtr = std::shared_ptr<const NativeVerificationResult>;
+
+    virtual ~NativeVerificationResult() = default;
+
+    virtual bool isOk() const = 0;
+};
+
 /// @brief A thin wrapper class for the VerificationResult to allow the instantiation of the arbitration graph classes.
 /// @details Analogous to the CommandWrapper, this wrapper holds a generic Python object.
 ///          A default constructed VerificationResultWrapper will always return true for isOk(), analogous to the
 ///          PlaceboResult.
+///          Whether the result is ok is resolved as cheaply as possible: Trivial results (default or bool constructed),
+///          plain Python bools and NativeVerificationResults are answered without calling into Python. For all other
+///          Python objects, the is_ok method is looked up once at construction.
+///          All methods calling into Python acquire the GIL, as the arbitrators call them with the GIL released.
 /// @throws: This wrapper will throw an exception if the Python object does not implement an is_ok() method.
 class VerificationResultWrapper {
 public:
-    VerificationResultWrapper() {
+    VerificationResultWrapper() : isOk_{true} {
         // This is analogous to the PlaceboResult
-        constructTrivialResult(true);
     }
-    explicit VerificationResultWrapper(bool isOk) {
+    explicit VerificationResultWrapper(bool isOk) : isOk_{isOk} {
         // This is analogous the implicit default constructor of the PlaceboResult
-        constructTrivialResult(isOk);
     }
     VerificationResultWrapper(const VerificationResultWrapper&) = default;
-    explicit VerificationResultWrapper(py::object verificationResult)
-            : verificationResult_{std::make_shared<py::object>(std::move(verificationResult))} {
+    explicit VerificationResultWrapper(py::object verificationResult) {
+        if (py::isinstance<py::bool_>(verificationResult)) {
+            isOk_ = verificationResult.cast<bool>();
+        } else if (py::isinstance<NativeVerificationResult>(verificationResult)) {
+            nativeResult_ = verificationResult.cast<NativeVerificationResult::ConstPtr>();
+        } else if (py::hasattr(verificationResult, "is_ok")) {
+            py::object isOk = verificationResult.attr("is_ok");
+            if (py::isinstance<py::function>(isOk)) {
+                isOkMethod_ = makeSharedObject(std::move(isOk));
+            }
+        }
+        verificationResult_ = makeSharedObject(std::move(verificationResult));
     }
 
     bool isOk() const {
-        if (!py::hasattr(value(), "is_ok")) {
-            throw py::attribute_error("Python object must have an 'is_ok' attribute");
+        if (isOk_) {
+            return isOk_.value();
+        }
+        if (nativeResult_) {
+            return nativeResult_->isOk();
         }
 
-        py::object is_ok = value().attr("is_ok"); // NOLINT(readability-identifier-naming)
-        if (!py::isinstance<py::function>(is_ok)) {
+        py::gil_scoped_acquire gil;
+        if (!isOkMethod_) {
+            if (!py::hasattr(value(), "is_ok")) {
+                throw py::attribute_error("Python object must have an 'is_ok' attribute");
+            }
             throw py::type_error("Python object 'is_ok' attribute must be a function");
         }
+        return (*isOkMethod_)().cast<bool>();
+    }
 
-        return is_ok().cast<bool>();
+    /// @brief True if the result has been constructed from a bool rather than a Python object.
+    bool isTrivial() const {
+        return !verificationResult_;
     }
 
+    /// @brief The wrapped Python object. For trivial results, an object with an is_ok() method is constructed.
     py::object value() const {
         if (!verificationResult_) {
-            throw std::runtime_error("VerificationResultWrapper is not initialized");
+            return constructTrivialResult(isOk());
         }
         return *verificationResult_;
     }
@@ -57,20 +95,32 @@ public:
 private:
     std::shared_ptr<py::object> verificationResult_;
 
+    /// Set for trivial results and plain Python bools
+    std::optional<bool> isOk_;
+    NativeVerificationResult::ConstPtr nativeResult_;
+    std::shared_ptr<py::object> isOkMethod_;
+
     /// @brief Constructs a python object with an is_ok() method that returns the given isOk value
-    void constructTrivialResult(bool isOk) {
+    static py::object constructTrivialResult(bool isOk) {
+        py::gil_scoped_acquire gil;
         // NOLINTNEXTLINE readability-identifier-naming
         py::object SimpleNamespace = py::module_::import("types").attr("SimpleNamespace");
         py::object result = SimpleNamespace();
 
         result.attr("is_ok") = py::cpp_function([isOk]() { return isOk; });
 
-        verificationResult_ = std::make_shared<py::object>(result);
+        return result;
     }
 };
 
 /// @brief Output stream operator utilizing the Python __repr__ or __str__ method of the object.
 inline std::ostream& operator<<(std::ostream& out, const VerificationResultWrapper& result) {
+    if (result.isTrivial()) {
+        out << (result.isOk() ? "is okay" : "is not okay");
+        return out;
+    }
+
+    py::gil_scoped_acquire gil;
     if (py::hasattr(result.value(), "__repr__")) {
         out << result.value().attr("__repr__")().cast<std::string>();
         return out;
@@ -85,38 +135,67 @@ inline std::ostream& operator<<(std::ostream& out, const VerificationResultWrapp
     return out;
 }
 
+/// @brief Base class for verifiers implemented in C++, e.g. loaded from a plugin.
+/// @details analyze() is called by the arbitrators without holding the GIL. Implementations must acquire it
+///          before accessing the command's value.
+class NativeVerifier {
+public:
+    using Ptr = std::shared_ptr<NativeVerifier>;
+    using ConstPtr = std::shared_ptr<const NativeVerifier>;
+
+    virtual ~NativeVerifier() = default;
+
+    virtual VerificationResultWrapper analyze(const arbitration_graphs::Time& time,
+                                              const CommandWrapper& command) const = 0;
+};
+
 /// @brief A thin wrapper class for the Verifier analogous to the CommandWrapper and the VerificationResultWrapper.
+/// @details The analyze method is looked up once at construction. A default constructed (or None) verifier behaves
+///          like the PlaceboVerifier and doesn't call into Python at all, neither does a NativeVerifier.
 /// @throws This wrapper will throw an exception if the Python object does not implement an analyze method that takes a
 /// Time and a Command as arguments and returns a VerificationResult.
 class VerifierWrapper {
 public:
-    VerifierWrapper() : verifier_(std::make_shared<py::object>(py::none())) {
-    }
+    VerifierWrapper() = default;
     VerifierWrapper(const VerifierWrapper&) = default;
-    explicit VerifierWrapper(py::object verifier) : verifier_{std::make_shared<py::object>(std::move(verifier))} {
+    explicit VerifierWrapper(py::object verifier) {
+        if (verifier.is_none()) {
+            return;
+        }
+        if (py::isinstance<NativeVerifier>(verifier)) {
+            nativeVerifier_ = verifier.cast<NativeVerifier::ConstPtr>();
+        } else if (py::hasattr(verifier, "analyze")) {
+            py::object analyze = verifier.attr("analyze");
+            if (py::isinstance<py::function>(analyze)) {
+                analyze_ = makeSharedObject(std::move(analyze));
+            }
+        }
+        verifier_ = makeSharedObject(std::move(verifier));
     }
 
     VerificationResultWrapper analyze(const arbitration_graphs::Time& time, const CommandWrapper& command) const {
-        if (value().is(py::none())) {
+        if (!verifier_) {
             // Analogous to the PlaceboVerifier, return a default constructed result,
             // if the verifier is default constructed
             return {};
         }
-        if (!py::hasattr(value(), "analyze")) {
-            throw py::attribute_error("Python object must have an 'analyze' attribute");
+        if (nativeVerifier_) {
+            return nativeVerifier_->analyze(time, command);
         }
 
-        py::object analyze = value().attr("analyze");
-        if (!py::isinstance<py::function>(analyze)) {
+        py::gil_scoped_acquire gil;
+        if (!analyze_) {
+            if (!py::hasattr(value(), "analyze")) {
+                throw py::attribute_error("Python object must have an 'analyze' attribute");
+            }
             throw py::type_error("Python object 'analyze' attribute must be a function");
         }
-
-        return VerificationResultWrapper(analyze(time, command.value()));
+        return VerificationResultWrapper((*analyze_)(time, command.value()));
     }
 
     py::object value() const {
         if (!verifier_) {
-            throw std::runtime_error("VerifierWrapper is not initialized");
+            return py::none();
         }
         return *verifier_;
     }
@@ -124,8 +203,34 @@ public:
 
 private:
     std::shared_ptr<py::object> verifier_;
+    std::shared_ptr<py::object> analyze_;
+    NativeVerifier::ConstPtr nativeVerifier_;
 };
 
+/// @brief Binds the base classes of native verifiers and results, so they can be passed through Python.
+inline void bindNativeVerification(py::module& module) {
+    py::class_<NativeVerificationResult, NativeVerificationResult::Ptr>(module, "NativeVerificationResult")
+        .def("is_ok", &NativeVerificationResult::isOk)
+        .def("__repr__", [](const NativeVerificationResult& self) {
+            return self.isOk() ? "<NativeVerificationResult is okay>" : "<NativeVerificationResult is not okay>";
+        });
+
+    py::class_<NativeVerifier, NativeVerifier::Ptr>(module, "NativeVerifier")
+        .def(
+            "analyze",
+            [](const NativeVerifier& self, const arbitration_graphs::Time& time, const CommandWrapper& command) {
+                VerificationResultWrapper result;
+                {
+                    py::gil_scoped_release release;
+                    result = self.analyze(time, command);
+                }
+                return result;
+            },
+            py::arg("time"),
+            py::arg("command"))
+        .def("__repr__", [](const NativeVerifier& /*self*/) { return "<NativeVerifier>"; });
+}
+
 } // namespace arbitration_graphs_py
 
 namespace pybind11 {
@@ -1,5 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+#include <string>
+
 #include <arbitration_graphs/types.hpp>
 #include <pybind11/pybind11.h>
 #include <yaml-cpp/yaml.h>
@@ -8,17 +15,196 @@ namespace arbitration_graphs_py::yaml_helper {
 
 namespace py = pybind11;
 
-/// @brief Extracts a python YAML representation of the given object.
+namespace internal {
+
+inline bool isOneOf(const std::string& value, std::initializer_list<const char*> candidates) {
+    return std::any_of(
+        candidates.begin(), candidates.end(), [&value](const char* candidate) { return value == candidate; });
+}
+
+/// @brief True if all characters from the given position on are digits of the given base or underscores.
+inline bool isDigitSequence(const std::string& value, const std::size_t& begin, const int& base) {
+    if (begin >= value.size()) {
+        return false;
+    }
+    return std::all_of(value.begin() + static_cast<std::ptrdiff_t>(begin), value.end(), [&base](const char& c) {
+        if (c == '_') {
+            return true;
+        }
+        if (base == 16) {
+            return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+        }
+        return c >= '0' && c < '0' + base;
+    });
+}
+
+inline std::string withoutUnderscores(std::string value) {
+    value.erase(std::remove(value.begin(), value.end(), '_'), value.end());
+    return value;
+}
+
+/// @brief Parses an integer the way the YAML 1.1 resolver of PyYAML's safe_load does, returns nullptr if it isn't one.
+/// @note Sexagesimal integers (e.g. 1:30) and timestamps are kept as strings, the arbitration graphs never emit them.
+inline py::object toInteger(const std::string& value) {
+    const std::size_t signLength = (value[0] == '-' || value[0] == '+') ? 1 : 0;
+    const std::string sign = value[0] == '-' ? "-" : "";
+
+    int base = 10;
+    std::size_t digitsBegin = signLength;
+    if (value.compare(signLength, 2, "0b") == 0) {
+        base = 2;
+        digitsBegin += 2;
+    } else if (value.compare(signLength, 2, "0x") == 0) {
+        base = 16;
+        digitsBegin += 2;
+    } else if (value.size() > signLength + 1 && value[signLength] == '0') {
+        base = 8;
+        digitsBegin += 1;
+    } else if (value.size() > signLength && value[signLength] == '_') {
+        return {};
+    }
+    if (!isDigitSequence(value, digitsBegin, base)) {
+        return {};
+    }
+
+    const std::string digits = withoutUnderscores(value.substr(digitsBegin));
+    if (digits.empty()) {
+        return {};
+    }
+
+    // Python integers are unbounded, so let Python parse the digits
+    PyObject* integer = PyLong_FromString((sign + digits).c_str(), nullptr, base);
+    if (integer == nullptr) {
+        PyErr_Clear();
+        return {};
+    }
+    return py::reinterpret_steal<py::object>(integer);
+}
+
+/// @brief Parses a float the way the YAML 1.1 resolver of PyYAML's safe_load does, returns nullptr if it isn't one.
+/// @details Unlike many other YAML parsers, PyYAML requires a dot for floats, e.g. 1e5 is a string.
+inline py::object toFloat(const std::string& value) {
+    if (isOneOf(value, {".inf", ".Inf", ".INF", "+.inf", "+.Inf", "+.INF"})) {
+        return py::float_(std::numeric_limits<double>::infinity());
+    }
+    if (isOneOf(value, {"-.inf", "-.Inf", "-.INF"})) {
+        return py::float_(-std::numeric_limits<double>::infinity());
+    }
+    if (isOneOf(value, {".nan", ".NaN", ".NAN"})) {
+        return py::float_(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    // [-+]?[0-9][0-9_]*\.[0-9_]*([eE][-+][0-9]+)? or \.[0-9][0-9_]*([eE][-+][0-9]+)?
+    std::size_t position = (value[0] == '-' || value[0] == '+') ? 1 : 0;
+    const std::size_t integerBegin = position;
+    while (position < value.size() && (std::isdigit(static_cast<unsigned char>(value[position])) != 0 ||
+                                       (position > integerBegin && value[position] == '_'))) {
+        position++;
+    }
+    const bool hasIntegerPart = position > integerBegin;
+    if (position >= value.size() || value[position] != '.') {
+        return {};
+    }
+    position++;
+    const std::size_t fractionBegin = position;
+    while (position < value.size() &&
+           (std::isdigit(static_cast<unsigned char>(value[position])) != 0 || value[position] == '_')) {
+        position++;
+    }
+    if (!hasIntegerPart && (integerBegin > 0 || position == fractionBegin || value[fractionBegin] == '_')) {
+        return {};
+    }
+    if (position < value.size()) {
+        if ((value[position] != 'e' && value[position] != 'E') || position + 1 >= value.size() ||
+            (value[position + 1] != '-' && value[position + 1] != '+') ||
+            !isDigitSequence(value, position + 2, 10) || value.find('_', position) != std::string::npos) {
+            return {};
+        }
+    }
+    return py::float_(std::strtod(withoutUnderscores(value).c_str(), nullptr));
+}
+
+/// @brief Converts a plain scalar to None, bool, int, float or str like PyYAML's safe_load would.
+inline py::object resolveScalar(const std::string& value) {
+    if (value.empty() || isOneOf(value, {"~", "null", "Null", "NULL"})) {
+        return py::none();
+    }
+    if (isOneOf(value, {"true", "True", "TRUE", "yes", "Yes", "YES", "on", "On", "ON"})) {
+        return py::bool_(true);
+    }
+    if (isOneOf(value, {"false", "False", "FALSE", "no", "No", "NO", "off", "Off", "OFF"})) {
+        return py::bool_(false);
+    }
+    const char first = value[0];
+    if (std::isdigit(static_cast<unsigned char>(first)) != 0 || first == '-' || first == '+' || first == '.') {
+        if (py::object integer = toInteger(value)) {
+            return integer;
+        }
+        if (py::object floatingPoint = toFloat(value)) {
+            return floatingPoint;
+        }
+    }
+    return py::str(value);
+}
+
+} // namespace internal
+
+/// @brief Converts a YAML node to the corresponding Python object (dict, list or scalar) without emitting YAML.
+/// @details The result matches what PyYAML's safe_load returns for the emitted node: Plain scalars are resolved to
+///          None, bool, int or float following the YAML 1.1 rules, while scalars tagged as strings stay strings.
+inline py::object toPythonObject(const YAML::Node& node) {
+    switch (node.Type()) {
+    case YAML::NodeType::Map: {
+        py::dict dict;
+        for (const auto& entry : node) {
+            dict[toPythonObject(entry.first)] = toPythonObject(entry.second);
+        }
+        return std::move(dict);
+    }
+    case YAML::NodeType::Sequence: {
+        py::list list(node.size());
+        std::size_t index = 0;
+        for (const auto& element : node) {
+            list[index++] = toPythonObject(element);
+        }
+        return std::move(list);
+    }
+    case YAML::NodeType::Scalar:
+        if (node.Tag() == "!" || node.Tag() == "tag:yaml.org,2002:str") {
+            return py::str(node.Scalar());
+        }
+        return internal::resolveScalar(node.Scalar());
+    case YAML::NodeType::Null:
+    case YAML::NodeType::Undefined:
+    default:
+        return py::none();
+    }
+}
+
+/// @brief Emits the YAML representation of the given object as string.
+/// @details The GIL is released while the (possibly nested) object is converted to YAML.
 /// @tparam YamlRepresentableT Object type to convert to YAML. Must implement the toYaml(const Time&) method.
 template <typename YamlRepresentableT>
-inline py::object toYamlAsPythonObject(const YamlRepresentableT& yamlRepresentable,
-                                       const arbitration_graphs::Time& time) {
+inline std::string toYamlString(const YamlRepresentableT& yamlRepresentable, const arbitration_graphs::Time& time) {
+    py::gil_scoped_release release;
     YAML::Emitter out;
     out << yamlRepresentable.toYaml(time);
-    std::string yamlStr = out.c_str();
+    return out.c_str();
+}
 
-    py::object yaml = py::module_::import("yaml");
-    return yaml.attr("safe_load")(yamlStr);
+/// @brief Extracts a python YAML representation of the given object.
+/// @details The YAML node is converted to Python dicts and lists directly, instead of emitting it and parsing it with
+///          the Python yaml module again. The GIL is released while the (possibly nested) object is converted to YAML.
+/// @tparam YamlRepresentableT Object type to convert to YAML. Must implement the toYaml(const Time&) method.
+template <typename YamlRepresentableT>
+inline py::object toYamlAsPythonObject(const YamlRepresentableT& yamlRepresentable,
+                                       const arbitration_graphs::Time& time) {
+    YAML::Node yaml;
+    {
+        py::gil_scoped_release release;
+        yaml = yamlRepresentable.toYaml(time);
+    }
+    return toPythonObject(yaml);
 }
 
 } // namespace arbitration_graphs_py::yaml_helper
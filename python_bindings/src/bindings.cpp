@@ -7,6 +7,7 @@
 #include "arbitration_graphs_py/behavior.hpp"
 #include "arbitration_graphs_py/cost_arbitrator.hpp"
 #include "arbitration_graphs_py/exceptions.hpp"
+#include "arbitration_graphs_py/plugin.hpp"
 #include "arbitration_graphs_py/priority_arbitrator.hpp"
 #include "arbitration_graphs_py/random_arbitrator.hpp"
 #include "arbitration_graphs_py/verification_wrapper.hpp"
@@ -31,7 +32,13 @@ void bindUtilCaching(py::module& module) {
 ///@brief Bindings for the arbitration_graphs library
 ///@details This is where it all comes together. The bindings for the individual classes are
 ///         created here in the main arbitration_graphs module.
+///         The module doesn't rely on the GIL: Graphs are traversed without it anyway and all calls into Python
+///         attach to the interpreter explicitly. Free-threaded interpreters therefore keep the GIL disabled.
+#if PYBIND11_VERSION_HEX >= 0x020D0000
+PYBIND11_MODULE(arbitration_graphs_py, mainModule, py::mod_gil_not_used()) {
+#else
 PYBIND11_MODULE(arbitration_graphs_py, mainModule) {
+#endif
     bindExceptions(mainModule);
 
     bindBehavior(mainModule);
@@ -39,6 +46,8 @@ PYBIND11_MODULE(arbitration_graphs_py, mainModule) {
     bindCostArbitrator(mainModule);
     bindPriorityArbitrator(mainModule);
     bindRandomArbitrator(mainModule);
+    bindNativeVerification(mainModule);
+    bindPlugin(mainModule);
 
     // Bind util_caching to be able to access cached verification results
     bindUtilCaching(mainModule);
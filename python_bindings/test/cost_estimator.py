@@ -14,3 +14,31 @@ class CostEstimatorFromCostMap(CostEstimator):
             return (self.cost_map[command] + self.activation_costs) / (
                 1 + self.activation_costs
             )
+
+
+class BatchCostEstimatorFromCostMap(CostEstimatorFromCostMap):
+    """Rates all commands of a cycle at once, counting the calls to both hooks."""
+
+    def __init__(self, cost_map, activation_costs=0, array_dtype=None):
+        super().__init__(cost_map, activation_costs)
+        self.array_dtype = array_dtype
+        self.estimate_cost_counter = 0
+        self.estimate_costs_counter = 0
+        self.last_batch_size = 0
+
+    def estimate_cost(self, command, is_active):
+        self.estimate_cost_counter += 1
+        return super().estimate_cost(command, is_active)
+
+    def estimate_costs(self, commands, is_active):
+        self.estimate_costs_counter += 1
+        self.last_batch_size = len(commands)
+        costs = [
+            super(BatchCostEstimatorFromCostMap, self).estimate_cost(command, active)
+            for command, active in zip(commands, is_active)
+        ]
+        if self.array_dtype is not None:
+            import numpy as np
+
+            return np.array(costs, dtype=self.array_dtype)
+        return costs
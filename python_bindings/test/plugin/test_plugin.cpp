@@ -0,0 +1,130 @@
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <arbitration_graphs_py/plugin.hpp>
+
+namespace {
+
+namespace ag = arbitration_graphs;
+namespace agpy = arbitration_graphs_py;
+namespace py = pybind11;
+
+/// @brief Returns a constant command, which is constructed once while holding the GIL.
+class ConstantBehavior : public ag::Behavior<agpy::CommandWrapper> {
+public:
+    ConstantBehavior(const std::string& name, py::object command, bool invocation, bool commitment)
+            : Behavior(name), command_{std::move(command)}, invocation_{invocation}, commitment_{commitment} {
+    }
+
+    agpy::CommandWrapper getCommand(const ag::Time& /*time*/) override {
+        return command_;
+    }
+    bool checkInvocationCondition(const ag::Time& /*time*/) const override {
+        return invocation_;
+    }
+    bool checkCommitmentCondition(const ag::Time& /*time*/) const override {
+        return commitment_;
+    }
+
+private:
+    agpy::CommandWrapper command_;
+    bool invocation_;
+    bool commitment_;
+};
+
+class ConstantVerifier : public agpy::NativeVerifier {
+public:
+    explicit ConstantVerifier(bool isOk) : isOk_{isOk} {
+    }
+
+    agpy::VerificationResultWrapper analyze(const ag::Time& /*time*/,
+                                            const agpy::CommandWrapper& /*command*/) const override {
+        return agpy::VerificationResultWrapper(isOk_);
+    }
+
+private:
+    bool isOk_;
+};
+
+class ConstantCostEstimator : public ag::CostEstimator<agpy::CommandWrapper> {
+public:
+    explicit ConstantCostEstimator(double cost) : cost_{cost} {
+    }
+
+    double estimateCost(const agpy::CommandWrapper& /*command*/, const bool /*isActive*/) override {
+        return cost_;
+    }
+
+private:
+    double cost_;
+};
+
+/// @brief Accepts array commands whose elements are all within [-limit, limit], reading them without copies.
+class ArrayBoundsVerifier : public agpy::NativeVerifier {
+public:
+    explicit ArrayBoundsVerifier(double limit) : limit_{limit} {
+    }
+
+    agpy::VerificationResultWrapper analyze(const ag::Time& /*time*/,
+                                            const agpy::CommandWrapper& command) const override {
+        const agpy::CommandArray* array = command.array();
+        if (array == nullptr || array->ndim() != 2) {
+            return agpy::VerificationResultWrapper(false);
+        }
+        for (py::ssize_t row = 0; row < array->shape(0); ++row) {
+            for (py::ssize_t col = 0; col < array->shape(1); ++col) {
+                if (std::abs((*array)(row, col)) > limit_) {
+                    return agpy::VerificationResultWrapper(false);
+                }
+            }
+        }
+        return agpy::VerificationResultWrapper(true);
+    }
+
+private:
+    double limit_;
+};
+
+/// @brief Rates array commands, e.g. trajectories, by the sum of their elements.
+class ArraySumCostEstimator : public ag::CostEstimator<agpy::CommandWrapper> {
+public:
+    double estimateCost(const agpy::CommandWrapper& command, const bool /*isActive*/) override {
+        const agpy::CommandArray* array = command.array();
+        if (array == nullptr || !array->isContiguous()) {
+            throw std::invalid_argument("ArraySumCostEstimator requires contiguous float64 arrays");
+        }
+        return std::accumulate(array->data(), array->data() + array->size(), 0.);
+    }
+};
+
+template <typename T>
+T parameter(const py::kwargs& parameters, const char* key, T defaultValue) {
+    return parameters.contains(key) ? parameters[key].cast<T>() : defaultValue;
+}
+
+} // namespace
+
+ARBITRATION_GRAPHS_PY_PLUGIN(registry) {
+    registry.addBehavior("ConstantBehavior", [](const py::kwargs& parameters) {
+        const auto name = parameter<std::string>(parameters, "name", "ConstantBehavior");
+        py::object command = parameters.contains("command") ? parameters["command"] : py::str(name);
+        return std::make_shared<ConstantBehavior>(name,
+                                                  std::move(command),
+                                                  parameter(parameters, "invocation", true),
+                                                  parameter(parameters, "commitment", true));
+    });
+    registry.addVerifier("ConstantVerifier", [](const py::kwargs& parameters) {
+        return std::make_shared<ConstantVerifier>(parameter(parameters, "is_ok", true));
+    });
+    registry.addVerifier("ArrayBoundsVerifier", [](const py::kwargs& parameters) {
+        return std::make_shared<ArrayBoundsVerifier>(parameter(parameters, "limit", 1.));
+    });
+    registry.addCostEstimator("ArraySumCostEstimator", [](const py::kwargs& /*parameters*/) {
+        return std::make_shared<ArraySumCostEstimator>();
+    });
+    registry.addCostEstimator("ConstantCostEstimator", [](const py::kwargs& parameters) {
+        return std::make_shared<ConstantCostEstimator>(parameter(parameters, "cost", 0.));
+    });
+}
@@ -4,7 +4,12 @@ import unittest
 
 import arbitration_graphs as ag
 from dummy_types import DummyBehavior, DummyCommand, PrintStrings
-from cost_estimator import CostEstimatorFromCostMap
+from cost_estimator import BatchCostEstimatorFromCostMap, CostEstimatorFromCostMap
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
 
 
 class CostArbitratorTest(unittest.TestCase):
@@ -333,3 +338,92 @@ class CostArbitratorTest(unittest.TestCase):
         self.assertTrue(self.test_cost_arbitrator.check_commitment_condition(self.time))
         self.assertEqual("mid_cost", self.test_cost_arbitrator.get_command(self.time))
         self.assertEqual("mid_cost", self.test_cost_arbitrator.get_command(self.time))
+
+    def check_batch_cost_estimation(self, array_dtype=None):
+        batch_cost_estimator = BatchCostEstimatorFromCostMap(
+            self.cost_map, array_dtype=array_dtype
+        )
+        other_batch_cost_estimator = BatchCostEstimatorFromCostMap(
+            self.cost_map, array_dtype=array_dtype
+        )
+
+        self.test_cost_arbitrator.add_option(
+            self.test_behavior_low_cost,
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            batch_cost_estimator,
+        )
+        self.test_cost_arbitrator.add_option(
+            self.test_behavior_high_cost,
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            batch_cost_estimator,
+        )
+        self.test_cost_arbitrator.add_option(
+            self.test_behavior_mid_cost,
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            batch_cost_estimator,
+        )
+        self.test_cost_arbitrator.add_option(
+            DummyBehavior(True, True, "high_cost"),
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            other_batch_cost_estimator,
+        )
+
+        self.test_cost_arbitrator.gain_control(self.time)
+        self.assertEqual("mid_cost", self.test_cost_arbitrator.get_command(self.time))
+
+        # All applicable options sharing a cost estimator are rated in a single call
+        self.assertEqual(1, batch_cost_estimator.estimate_costs_counter)
+        self.assertEqual(2, batch_cost_estimator.last_batch_size)
+        self.assertEqual(1, other_batch_cost_estimator.estimate_costs_counter)
+        self.assertEqual(1, other_batch_cost_estimator.last_batch_size)
+        self.assertEqual(0, batch_cost_estimator.estimate_cost_counter)
+        self.assertEqual(0, other_batch_cost_estimator.estimate_cost_counter)
+
+        yaml_node = self.test_cost_arbitrator.to_yaml(self.time)
+        self.assertAlmostEqual(1.0, yaml_node["options"][1]["cost"])
+        self.assertAlmostEqual(0.5, yaml_node["options"][2]["cost"])
+        self.assertAlmostEqual(1.0, yaml_node["options"][3]["cost"])
+
+    def test_batch_cost_estimation(self):
+        self.check_batch_cost_estimation()
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_batch_cost_estimation_with_arrays(self):
+        # float64 arrays are read directly from their buffer
+        self.check_batch_cost_estimation(array_dtype=np.float64)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_batch_cost_estimation_with_other_arrays(self):
+        # Arrays of other types are converted element by element
+        self.check_batch_cost_estimation(array_dtype=np.float32)
+
+    def test_batch_cost_estimation_with_wrong_size(self):
+        class WrongSizeCostEstimator(ag.CostEstimator):
+            def estimate_costs(self, commands, is_active):
+                return [0.0] * (len(commands) + 1)
+
+        self.test_cost_arbitrator.add_option(
+            self.test_behavior_mid_cost,
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            WrongSizeCostEstimator(),
+        )
+
+        self.test_cost_arbitrator.gain_control(self.time)
+        with self.assertRaises(ValueError):
+            self.test_cost_arbitrator.get_command(self.time)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_batch_cost_estimation_with_wrong_size_array(self):
+        class WrongSizeCostEstimator(ag.CostEstimator):
+            def estimate_costs(self, commands, is_active):
+                return np.zeros(len(commands) + 1)
+
+        self.test_cost_arbitrator.add_option(
+            self.test_behavior_mid_cost,
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            WrongSizeCostEstimator(),
+        )
+
+        self.test_cost_arbitrator.gain_control(self.time)
+        with self.assertRaises(ValueError):
+            self.test_cost_arbitrator.get_command(self.time)
@@ -0,0 +1,115 @@
+import sys
+import sysconfig
+import threading
+import time
+import unittest
+
+import arbitration_graphs as ag
+
+from cost_estimator import CostEstimatorFromCostMap
+from dummy_types import DummyBehavior
+
+FREE_THREADED_BUILD = bool(sysconfig.get_config_var("Py_GIL_DISABLED"))
+
+
+class BarrierBehavior(DummyBehavior):
+    """Only returns a command once all behaviors sharing the barrier are evaluated concurrently."""
+
+    def __init__(self, barrier, name):
+        super().__init__(True, False, name)
+        self.barrier = barrier
+
+    def get_command(self, time):
+        self.barrier.wait()
+        return self.name
+
+
+class FailingCostEstimator(ag.CostEstimator):
+    def estimate_cost(self, command, is_active):
+        raise ValueError("FailingCostEstimator is broken")
+
+
+class FreeThreadingTest(unittest.TestCase):
+    def setUp(self):
+        self.time = time.time()
+
+    @unittest.skipUnless(FREE_THREADED_BUILD, "Requires a free-threaded interpreter")
+    def test_gil_stays_disabled(self):
+        # Importing a module that doesn't declare free-threading support would have re-enabled the GIL
+        self.assertFalse(sys._is_gil_enabled())
+
+    def test_num_threads(self):
+        cost_arbitrator = ag.CostArbitrator()
+        self.assertEqual(1, cost_arbitrator.num_threads)
+
+        cost_arbitrator.num_threads = 4
+        self.assertEqual(4, cost_arbitrator.num_threads)
+
+        cost_arbitrator.num_threads = 0
+        self.assertEqual(1, cost_arbitrator.num_threads)
+
+    def test_parallel_cost_arbitration(self):
+        names = [f"option_{index}" for index in range(8)]
+        cost_map = {name: abs(3.5 - index) for index, name in enumerate(names)}
+
+        arbitrators = []
+        for num_threads in [1, 4]:
+            cost_arbitrator = ag.CostArbitrator(f"cost_{num_threads}")
+            cost_arbitrator.num_threads = num_threads
+            for name in names:
+                # One cost estimator per option, so that these are evaluated in parallel as well
+                cost_arbitrator.add_option(
+                    DummyBehavior(True, False, name),
+                    ag.CostArbitrator.Option.Flags.NO_FLAGS,
+                    CostEstimatorFromCostMap(cost_map),
+                )
+            cost_arbitrator.gain_control(self.time)
+            arbitrators.append(cost_arbitrator)
+
+        sequential, parallel = arbitrators
+        for cycle in range(50):
+            now = self.time + cycle
+            self.assertEqual("option_3", parallel.get_command(now))
+            self.assertEqual(sequential.get_command(now), parallel.get_command(now))
+        self.assertEqual(
+            sequential.to_yaml(self.time + 49)["options"],
+            parallel.to_yaml(self.time + 49)["options"],
+        )
+
+    def test_options_are_evaluated_concurrently(self):
+        num_options = 4
+        barrier = threading.Barrier(num_options, timeout=10)
+
+        cost_arbitrator = ag.CostArbitrator()
+        cost_arbitrator.num_threads = num_options
+        cost_estimator = CostEstimatorFromCostMap(
+            {f"option_{index}": index for index in range(num_options)}
+        )
+        for index in range(num_options):
+            cost_arbitrator.add_option(
+                BarrierBehavior(barrier, f"option_{index}"),
+                ag.CostArbitrator.Option.Flags.NO_FLAGS,
+                cost_estimator,
+            )
+
+        cost_arbitrator.gain_control(self.time)
+        # Sequential evaluation would break the barrier after its timeout and fail all options
+        self.assertEqual("option_0", cost_arbitrator.get_command(self.time))
+
+    def test_exceptions_are_propagated(self):
+        cost_arbitrator = ag.CostArbitrator()
+        cost_arbitrator.num_threads = 4
+        for index in range(4):
+            cost_arbitrator.add_option(
+                DummyBehavior(True, False, f"option_{index}"),
+                ag.CostArbitrator.Option.Flags.NO_FLAGS,
+                FailingCostEstimator(),
+            )
+
+        cost_arbitrator.gain_control(self.time)
+        with self.assertRaises(ValueError):
+            cost_arbitrator.get_command(self.time)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,138 @@
+import pickle
+import time
+import unittest
+
+from concurrent.futures import ProcessPoolExecutor
+
+import arbitration_graphs as ag
+
+from cost_estimator import CostEstimatorFromCostMap
+from dummy_types import DummyBehavior, DummyVerifier
+
+
+def build_graph():
+    cost_map = {"low_cost": 0, "mid_cost": 0.5, "high_cost": 1}
+    cost_estimator = CostEstimatorFromCostMap(cost_map)
+
+    cost_arbitrator = ag.CostArbitrator("cost", DummyVerifier("low_cost"))
+    cost_arbitrator.num_threads = 2
+    cost_arbitrator.add_option(
+        DummyBehavior(True, True, "low_cost"),
+        ag.CostArbitrator.Option.Flags.NO_FLAGS,
+        cost_estimator,
+    )
+    cost_arbitrator.add_option(
+        DummyBehavior(True, False, "mid_cost"),
+        ag.CostArbitrator.Option.Flags.INTERRUPTABLE,
+        cost_estimator,
+    )
+    cost_arbitrator.add_option(
+        DummyBehavior(True, True, "high_cost"),
+        ag.CostArbitrator.Option.Flags.NO_FLAGS,
+        cost_estimator,
+    )
+
+    shared_behavior = DummyBehavior(False, False, "shared")
+    random_arbitrator = ag.RandomArbitrator("random")
+    random_arbitrator.add_option(
+        shared_behavior, ag.RandomArbitrator.Option.Flags.NO_FLAGS, 0.3
+    )
+
+    root = ag.PriorityArbitrator("root")
+    root.add_option(shared_behavior, ag.PriorityArbitrator.Option.Flags.NO_FLAGS)
+    root.add_option(random_arbitrator, ag.PriorityArbitrator.Option.Flags.NO_FLAGS)
+    root.add_option(cost_arbitrator, ag.PriorityArbitrator.Option.Flags.INTERRUPTABLE)
+    root.add_option(
+        DummyBehavior(True, True, "fallback"),
+        ag.PriorityArbitrator.Option.Flags.FALLBACK,
+    )
+    return root
+
+
+def run_cycles(graph, start, num_cycles):
+    commands = []
+    for cycle in range(num_cycles):
+        commands.append(graph.get_command(start + cycle))
+    return commands
+
+
+class PicklingTest(unittest.TestCase):
+    def setUp(self):
+        self.time = time.time()
+
+    def test_round_trip(self):
+        graph = build_graph()
+        graph.gain_control(self.time)
+        self.assertEqual("mid_cost", graph.get_command(self.time))
+
+        restored = pickle.loads(pickle.dumps(graph))
+
+        self.assertIsInstance(restored, ag.PriorityArbitrator)
+        self.assertEqual("root", restored.name)
+
+        # Transient caches are dropped, so compare at a time that hasn't been evaluated yet
+        later = self.time + 1
+        self.assertEqual(graph.to_yaml(later), restored.to_yaml(later))
+
+        cost_arbitrator = restored.options()[2].behavior
+        self.assertIsInstance(cost_arbitrator, ag.CostArbitrator)
+        self.assertEqual(2, cost_arbitrator.num_threads)
+        self.assertEqual(2, restored.to_yaml(later)["activeBehavior"])
+        self.assertEqual(1, cost_arbitrator.to_yaml(later)["activeBehavior"])
+
+        # The restored graph continues where the original one stopped
+        self.assertEqual(run_cycles(graph, later, 5), run_cycles(restored, later, 5))
+
+    def test_shared_instances_stay_shared(self):
+        restored = pickle.loads(pickle.dumps(build_graph()))
+
+        random_arbitrator = restored.options()[1].behavior
+        self.assertIs(
+            restored.options()[0].behavior, random_arbitrator.options()[0].behavior
+        )
+
+    def test_python_attributes(self):
+        behavior = DummyBehavior(True, False, "behavior")
+        behavior.lose_control_counter = 3
+
+        restored = pickle.loads(pickle.dumps(behavior))
+
+        self.assertIsInstance(restored, DummyBehavior)
+        self.assertEqual("behavior", restored.name)
+        self.assertEqual(3, restored.lose_control_counter)
+        self.assertTrue(restored.check_invocation_condition(self.time))
+        self.assertFalse(restored.check_commitment_condition(self.time))
+
+    def test_corrupt_state(self):
+        state = build_graph().__getstate__()
+        name, verifier, behaviors, cost_estimators, encoded, attributes = state
+
+        restored = ag.PriorityArbitrator.__new__(ag.PriorityArbitrator)
+        with self.assertRaises(ValueError):
+            restored.__setstate__(
+                (name, verifier, behaviors, cost_estimators, encoded[:-1], attributes)
+            )
+
+    def test_encoding_is_little_endian(self):
+        encoded = build_graph().__getstate__()[4]
+
+        # Version, number of options and, without an active option, an active option index of -1
+        self.assertEqual(2, encoded[0])
+        self.assertEqual(4, int.from_bytes(encoded[1:5], "little"))
+        self.assertEqual(-1, int.from_bytes(encoded[-8:], "little", signed=True))
+
+    def test_ship_to_worker_process(self):
+        graph = build_graph()
+        graph.gain_control(self.time)
+        expected = run_cycles(graph, self.time, 10)
+
+        graph = build_graph()
+        graph.gain_control(self.time)
+        with ProcessPoolExecutor(max_workers=1) as executor:
+            result = executor.submit(run_cycles, graph, self.time, 10).result()
+
+        self.assertEqual(expected, result)
+
+
+if __name__ == "__main__":
+    unittest.main()
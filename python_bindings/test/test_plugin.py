@@ -0,0 +1,142 @@
+import os
+import time
+import unittest
+
+import arbitration_graphs as ag
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+from cost_estimator import CostEstimatorFromCostMap
+from dummy_types import DummyBehavior
+
+PLUGIN_PATH = os.environ.get("ARBITRATION_GRAPHS_TEST_PLUGIN")
+
+
+class PluginLoadingTest(unittest.TestCase):
+    def test_invalid_library(self):
+        with self.assertRaises(ImportError):
+            ag.Plugin("/nonexistent/plugin.so")
+
+
+@unittest.skipIf(
+    PLUGIN_PATH is None,
+    "Set ARBITRATION_GRAPHS_TEST_PLUGIN to the library built from test/plugin",
+)
+class PluginTest(unittest.TestCase):
+    def setUp(self):
+        self.plugin = ag.Plugin(PLUGIN_PATH)
+        self.time = time.time()
+
+    def test_registered_types(self):
+        self.assertEqual(["ConstantBehavior"], self.plugin.behavior_types())
+        self.assertEqual(
+            ["ArrayBoundsVerifier", "ConstantVerifier"], self.plugin.verifier_types()
+        )
+        self.assertEqual(
+            ["ArraySumCostEstimator", "ConstantCostEstimator"],
+            self.plugin.cost_estimator_types(),
+        )
+
+    def test_unknown_type(self):
+        with self.assertRaises(KeyError):
+            self.plugin.create_behavior("UnknownBehavior")
+
+    def test_native_behavior(self):
+        behavior = self.plugin.create_behavior(
+            "ConstantBehavior", name="native", command="forward", commitment=False
+        )
+
+        self.assertIsInstance(behavior, ag.Behavior)
+        self.assertEqual("native", behavior.name)
+        self.assertTrue(behavior.check_invocation_condition(self.time))
+        self.assertFalse(behavior.check_commitment_condition(self.time))
+        self.assertEqual("forward", behavior.get_command(self.time))
+
+    def test_mixed_graph(self):
+        """Native and Python leaves can be combined in a Python-built graph."""
+        cost_arbitrator = ag.CostArbitrator(
+            "cost", self.plugin.create_verifier("ConstantVerifier", is_ok=True)
+        )
+        cost_arbitrator.add_option(
+            self.plugin.create_behavior("ConstantBehavior", name="native"),
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            self.plugin.create_cost_estimator("ConstantCostEstimator", cost=0.5),
+        )
+        cost_arbitrator.add_option(
+            DummyBehavior(True, True, "python"),
+            ag.CostArbitrator.Option.Flags.NO_FLAGS,
+            CostEstimatorFromCostMap({"python": 1.0}),
+        )
+
+        cost_arbitrator.gain_control(self.time)
+        self.assertEqual("native", cost_arbitrator.get_command(self.time))
+        self.assertTrue(
+            cost_arbitrator.options()[0].verification_result.cached(self.time)
+        )
+
+    def test_rejecting_verifier(self):
+        priority_arbitrator = ag.PriorityArbitrator(
+            "priority", self.plugin.create_verifier("ConstantVerifier", is_ok=False)
+        )
+        priority_arbitrator.add_option(
+            self.plugin.create_behavior("ConstantBehavior", name="native"),
+            ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+        )
+
+        priority_arbitrator.gain_control(self.time)
+        with self.assertRaises(ag.NoApplicableOptionPassedVerificationError):
+            priority_arbitrator.get_command(self.time)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_array_commands(self):
+        """Native verifiers and cost estimators read NumPy commands without copies."""
+
+        class TrajectoryBehavior(ag.Behavior):
+            def __init__(self, name, trajectory):
+                super().__init__(name)
+                self.trajectory = trajectory
+
+            def get_command(self, time):
+                return self.trajectory
+
+        short_trajectory = np.array([[0.0, 0.0], [0.5, 0.5]])
+        long_trajectory = np.array([[0.0, 0.0], [1.0, 1.0]])
+        invalid_trajectory = np.array([[0.0, 0.0], [2.0, 0.0]])
+
+        cost_arbitrator = ag.CostArbitrator(
+            "cost", self.plugin.create_verifier("ArrayBoundsVerifier", limit=1.5)
+        )
+        cost_estimator = self.plugin.create_cost_estimator("ArraySumCostEstimator")
+        for name, trajectory in [
+            ("invalid", invalid_trajectory),
+            ("long", long_trajectory),
+            ("short", short_trajectory),
+        ]:
+            cost_arbitrator.add_option(
+                TrajectoryBehavior(name, trajectory),
+                ag.CostArbitrator.Option.Flags.NO_FLAGS,
+                cost_estimator,
+            )
+
+        cost_arbitrator.gain_control(self.time)
+        self.assertIs(short_trajectory, cost_arbitrator.get_command(self.time))
+
+        # Modifying the array in place is visible to C++, as nothing has been copied
+        short_trajectory[1, 0] = 5.0
+        self.assertIs(long_trajectory, cost_arbitrator.get_command(self.time + 1))
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_non_contiguous_array_command(self):
+        verifier = self.plugin.create_verifier("ArrayBoundsVerifier", limit=1.0)
+        trajectory = np.array([[0.0, 5.0], [1.0, 5.0]])
+
+        self.assertTrue(verifier.analyze(self.time, trajectory[:, :1]).is_ok())
+        self.assertFalse(verifier.analyze(self.time, trajectory).is_ok())
+        self.assertFalse(verifier.analyze(self.time, "not an array").is_ok())
+
+
+if __name__ == "__main__":
+    unittest.main()
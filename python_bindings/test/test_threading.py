@@ -0,0 +1,95 @@
+import threading
+import time
+import unittest
+
+import arbitration_graphs as ag
+
+from cost_estimator import CostEstimatorFromCostMap
+from dummy_types import DummyBehavior, DummyVerifier
+
+
+def build_graph(verifier):
+    cost_arbitrator = ag.CostArbitrator("cost", verifier)
+    cost_map = {"low_cost": 0, "high_cost": 1}
+    cost_estimator = CostEstimatorFromCostMap(cost_map)
+    cost_arbitrator.add_option(
+        DummyBehavior(True, True, "high_cost"),
+        ag.CostArbitrator.Option.Flags.NO_FLAGS,
+        cost_estimator,
+    )
+    cost_arbitrator.add_option(
+        DummyBehavior(True, True, "low_cost"),
+        ag.CostArbitrator.Option.Flags.NO_FLAGS,
+        cost_estimator,
+    )
+
+    root = ag.PriorityArbitrator("root", verifier)
+    root.add_option(
+        DummyBehavior(False, False, "never"),
+        ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+    )
+    root.add_option(cost_arbitrator, ag.PriorityArbitrator.Option.Flags.NO_FLAGS)
+    return root
+
+
+class ThreadingTest(unittest.TestCase):
+    """The GIL is released during arbitration and re-acquired for each call into Python."""
+
+    def test_concurrent_arbitration(self):
+        num_threads = 8
+        num_cycles = 200
+        results = [[] for _ in range(num_threads)]
+        errors = []
+
+        def run(index):
+            try:
+                # Reject the cheaper option to exercise the verifier callbacks as well
+                graph = build_graph(DummyVerifier("low_cost"))
+                start = time.time()
+                for cycle in range(num_cycles):
+                    now = start + cycle
+                    if graph.check_invocation_condition(now):
+                        graph.gain_control(now)
+                        results[index].append(graph.get_command(now))
+                        graph.to_yaml(now)
+                # Drop the graph and all cached commands within the worker thread
+                del graph
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(num_threads)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(errors, [])
+        for result in results:
+            self.assertEqual(result, ["high_cost"] * num_cycles)
+
+    def test_other_threads_progress_during_arbitration(self):
+        stop = threading.Event()
+        ticks = []
+
+        def tick():
+            while not stop.is_set():
+                ticks.append(None)
+                time.sleep(0)
+
+        ticker = threading.Thread(target=tick)
+        ticker.start()
+        try:
+            graph = build_graph(DummyVerifier())
+            now = time.time()
+            graph.gain_control(now)
+            for cycle in range(200):
+                self.assertEqual(graph.get_command(now + cycle), "low_cost")
+        finally:
+            stop.set()
+            ticker.join()
+
+        self.assertGreater(len(ticks), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
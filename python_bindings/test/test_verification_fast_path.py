@@ -0,0 +1,69 @@
+import time
+import unittest
+
+import arbitration_graphs as ag
+
+from dummy_types import DummyBehavior
+
+
+class BoolVerifier:
+    """Returns plain bools, which the bindings evaluate without calling back into Python."""
+
+    def __init__(self, wrong=""):
+        self.wrong = wrong
+
+    def analyze(self, time, command):
+        return command != self.wrong
+
+
+class VerificationFastPathTest(unittest.TestCase):
+    def setUp(self):
+        self.time = time.time()
+
+    def make_arbitrator(self, verifier=None):
+        if verifier is None:
+            arbitrator = ag.PriorityArbitrator("root")
+        else:
+            arbitrator = ag.PriorityArbitrator("root", verifier)
+
+        arbitrator.add_option(
+            DummyBehavior(True, False, "HighPriority"),
+            ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+        )
+        arbitrator.add_option(
+            DummyBehavior(True, True, "LowPriority"),
+            ag.PriorityArbitrator.Option.Flags.NO_FLAGS,
+        )
+        return arbitrator
+
+    def test_bool_results(self):
+        arbitrator = self.make_arbitrator(BoolVerifier("HighPriority"))
+        arbitrator.gain_control(self.time)
+
+        self.assertEqual("LowPriority", arbitrator.get_command(self.time))
+        self.assertIs(
+            False, arbitrator.options()[0].verification_result.cached(self.time)
+        )
+        self.assertIs(
+            True, arbitrator.options()[1].verification_result.cached(self.time)
+        )
+
+        yaml_node = arbitrator.to_yaml(self.time)
+        self.assertEqual("failed", yaml_node["options"][0]["verificationResult"])
+        self.assertEqual("passed", yaml_node["options"][1]["verificationResult"])
+
+    def test_native_result_type_is_exposed(self):
+        self.assertTrue(hasattr(ag, "NativeVerificationResult"))
+
+    def test_default_verifier_results(self):
+        arbitrator = self.make_arbitrator()
+        arbitrator.gain_control(self.time)
+
+        self.assertEqual("HighPriority", arbitrator.get_command(self.time))
+        self.assertTrue(
+            arbitrator.options()[0].verification_result.cached(self.time).is_ok()
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,69 @@
+import time
+import unittest
+
+import yaml
+
+import arbitration_graphs as ag
+
+from cost_estimator import CostEstimatorFromCostMap
+from dummy_types import DummyBehavior, DummyVerifier
+
+
+class YamlConversionTest(unittest.TestCase):
+    """to_yaml() converts the YAML nodes to dicts natively, it has to match parsing the emitted YAML string."""
+
+    def setUp(self):
+        cost_map = {"low_cost": 0, "mid_cost": 0.5, "high_cost": 1}
+        self.cost_estimator = CostEstimatorFromCostMap(cost_map)
+
+        self.cost_arbitrator = ag.CostArbitrator("cost", DummyVerifier("low_cost"))
+        for name in ["low_cost", "mid_cost", "high_cost"]:
+            self.cost_arbitrator.add_option(
+                DummyBehavior(True, True, name),
+                ag.CostArbitrator.Option.Flags.INTERRUPTABLE,
+                self.cost_estimator,
+            )
+
+        self.random_arbitrator = ag.RandomArbitrator("random")
+        self.random_arbitrator.add_option(
+            DummyBehavior(False, False, "not_applicable"),
+            ag.RandomArbitrator.Option.Flags.NO_FLAGS,
+            0.5,
+        )
+
+        self.root = ag.PriorityArbitrator("root")
+        self.root.add_option(
+            self.random_arbitrator, ag.PriorityArbitrator.Option.Flags.NO_FLAGS
+        )
+        self.root.add_option(
+            self.cost_arbitrator, ag.PriorityArbitrator.Option.Flags.INTERRUPTABLE
+        )
+        self.root.add_option(
+            DummyBehavior(True, True, "fallback"),
+            ag.PriorityArbitrator.Option.Flags.FALLBACK,
+        )
+
+        self.time = time.time()
+
+    def test_matches_safe_load(self):
+        self.assertEqual(
+            yaml.safe_load(self.root.to_yaml_string(self.time)),
+            self.root.to_yaml(self.time),
+        )
+
+        self.root.gain_control(self.time)
+        self.root.get_command(self.time)
+        self.assertEqual(
+            yaml.safe_load(self.root.to_yaml_string(self.time)),
+            self.root.to_yaml(self.time),
+        )
+
+        behavior = DummyBehavior(True, False, "behavior")
+        self.assertEqual(
+            yaml.safe_load(behavior.to_yaml_string(self.time)),
+            behavior.to_yaml(self.time),
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
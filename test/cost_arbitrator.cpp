@@ -35,9 +35,15 @@
 //	  ASSERT_FLOAT_EQ((10.0f + 2.0f) * 3.0f, 10.0f * 3.0f + 2.0f * 3.0f)
 //}
 //=======================================================================================================================================================
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 #include "behavior.hpp"
@@ -337,3 +343,117 @@ TEST(CostArbitrator, SubCommandTypeDiffersFromCommandType) {
     std::string expected = "__mid_cost__";
     EXPECT_EQ(expected.length(), testCostArbitrator.getCommand(time));
 }
+
+TEST_F(CostArbitratorTest, BatchCostEstimation) {
+    BatchCostEstimatorFromCostMap::Ptr batchCostEstimator = std::make_shared<BatchCostEstimatorFromCostMap>(costMap);
+    BatchCostEstimatorFromCostMap::Ptr otherBatchCostEstimator =
+        std::make_shared<BatchCostEstimatorFromCostMap>(costMap);
+
+    testCostArbitrator.addOption(testBehaviorLowCost, OptionFlags::NO_FLAGS, batchCostEstimator);
+    testCostArbitrator.addOption(testBehaviorHighCost, OptionFlags::NO_FLAGS, batchCostEstimator);
+    testCostArbitrator.addOption(testBehaviorMidCost, OptionFlags::NO_FLAGS, batchCostEstimator);
+    testCostArbitrator.addOption(testBehaviorHighCost, OptionFlags::NO_FLAGS, otherBatchCostEstimator);
+
+    testCostArbitrator.gainControl(time);
+    EXPECT_EQ("mid_cost", testCostArbitrator.getCommand(time));
+
+    // All applicable options sharing a cost estimator are rated in a single call
+    EXPECT_EQ(1, batchCostEstimator->estimateCostsCounter_);
+    EXPECT_EQ(2, batchCostEstimator->lastBatchSize_);
+    EXPECT_EQ(1, otherBatchCostEstimator->estimateCostsCounter_);
+    EXPECT_EQ(1, otherBatchCostEstimator->lastBatchSize_);
+
+    YAML::Node yaml = testCostArbitrator.toYaml(time);
+    EXPECT_FALSE(yaml["options"][0]["cost"].IsDefined());
+    EXPECT_NEAR(1.0, yaml["options"][1]["cost"].as<double>(), 1e-3);
+    EXPECT_NEAR(0.5, yaml["options"][2]["cost"].as<double>(), 1e-3);
+    EXPECT_NEAR(1.0, yaml["options"][3]["cost"].as<double>(), 1e-3);
+}
+
+TEST_F(CostArbitratorTest, ParallelEvaluation) {
+    CostArbitrator<DummyCommand> sequentialCostArbitrator;
+    testCostArbitrator.setNumThreads(4);
+    EXPECT_EQ(4, testCostArbitrator.numThreads());
+    EXPECT_EQ(1, sequentialCostArbitrator.numThreads());
+
+    std::vector<BatchCostEstimatorFromCostMap::Ptr> costEstimators;
+    for (int i = 0; i < 8; ++i) {
+        const std::string name = "option_" + std::to_string(i);
+        CostEstimatorFromCostMap::CostMap options{{name, std::abs(3.5 - i)}};
+        costEstimators.push_back(std::make_shared<BatchCostEstimatorFromCostMap>(options));
+
+        testCostArbitrator.addOption(
+            std::make_shared<DummyBehavior>(true, false, name), OptionFlags::NO_FLAGS, costEstimators.back());
+        sequentialCostArbitrator.addOption(
+            std::make_shared<DummyBehavior>(true, false, name), OptionFlags::NO_FLAGS, costEstimators.back());
+    }
+
+    testCostArbitrator.gainControl(time);
+    sequentialCostArbitrator.gainControl(time);
+    EXPECT_EQ("option_3", testCostArbitrator.getCommand(time));
+    EXPECT_EQ(sequentialCostArbitrator.getCommand(time), testCostArbitrator.getCommand(time));
+
+    for (const auto& costEstimator : costEstimators) {
+        EXPECT_EQ(3, costEstimator->estimateCostsCounter_);
+        EXPECT_EQ(1, costEstimator->lastBatchSize_);
+    }
+
+    YAML::Node yaml = testCostArbitrator.toYaml(time);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_NEAR(std::abs(3.5 - i), yaml["options"][i]["cost"].as<double>(), 1e-3);
+    }
+}
+
+/// A behavior that takes a while to compute its command and counts how often it was called concurrently
+class SlowDummyBehavior : public DummyBehavior {
+public:
+    using Ptr = std::shared_ptr<SlowDummyBehavior>;
+    using DummyBehavior::DummyBehavior;
+
+    DummyCommand getCommand(const Time& time) override {
+        if (numActiveCalls_++ > 0) {
+            numConcurrentCalls_++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        numActiveCalls_--;
+        return DummyBehavior::getCommand(time);
+    }
+
+    std::atomic<int> numActiveCalls_{0};
+    std::atomic<int> numConcurrentCalls_{0};
+};
+
+TEST_F(CostArbitratorTest, ParallelEvaluationOfSharedBehaviors) {
+    testCostArbitrator.setNumThreads(4);
+
+    SlowDummyBehavior::Ptr sharedBehavior = std::make_shared<SlowDummyBehavior>(true, false, "mid_cost");
+    for (int i = 0; i < 4; ++i) {
+        testCostArbitrator.addOption(sharedBehavior, OptionFlags::NO_FLAGS, cost_estimator);
+        testCostArbitrator.addOption(
+            std::make_shared<SlowDummyBehavior>(true, false, "high_cost"), OptionFlags::NO_FLAGS, cost_estimator);
+    }
+
+    testCostArbitrator.gainControl(time);
+    for (int cycle = 0; cycle < 10; ++cycle) {
+        time = time + Duration(1);
+        EXPECT_EQ("mid_cost", testCostArbitrator.getCommand(time));
+    }
+
+    // Options of the same behavior are evaluated by a single thread
+    EXPECT_EQ(0, sharedBehavior->numConcurrentCalls_);
+    EXPECT_LE(40, sharedBehavior->getCommandCounter_);
+}
+
+TEST_F(CostArbitratorTest, ParallelEvaluationRethrowsExceptions) {
+    testCostArbitrator.setNumThreads(4);
+
+    // The cost map doesn't know the command of the last behavior
+    CostEstimatorFromCostMap::Ptr incompleteCostEstimator = std::make_shared<CostEstimatorFromCostMap>(costMap);
+    testCostArbitrator.addOption(testBehaviorMidCost, OptionFlags::NO_FLAGS, cost_estimator);
+    testCostArbitrator.addOption(testBehaviorHighCost, OptionFlags::NO_FLAGS, cost_estimator_with_activation_costs);
+    testCostArbitrator.addOption(
+        std::make_shared<DummyBehavior>(true, true, "unknown"), OptionFlags::NO_FLAGS, incompleteCostEstimator);
+
+    testCostArbitrator.gainControl(time);
+    EXPECT_THROW(testCostArbitrator.getCommand(time), std::out_of_range);
+}
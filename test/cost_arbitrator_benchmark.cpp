@@ -0,0 +1,141 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "behavior.hpp"
+#include "cost_arbitrator.hpp"
+
+#include "cost_estimator.hpp"
+#include "dummy_types.hpp"
+
+
+using namespace arbitration_graphs;
+using namespace arbitration_graphs_tests;
+
+
+class CostArbitratorBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    using OptionFlags = CostArbitrator<DummyCommand>::Option::Flags;
+
+    void SetUp() override {
+        const int numOptions = GetParam();
+
+        CostEstimatorFromCostMap::CostMap costMap;
+        for (int i = 0; i < numOptions; ++i) {
+            const std::string name = "option_" + std::to_string(i);
+            // pseudo random, but reproducible costs with a unique minimum at numOptions / 2
+            costMap[name] = i == numOptions / 2 ? 0. : 1. + (i * 7919) % numOptions;
+            behaviors_.push_back(std::make_shared<DummyBehavior>(true, false, name));
+        }
+        costEstimator_ = std::make_shared<CostEstimatorFromCostMap>(costMap);
+
+        for (const auto& behavior : behaviors_) {
+            testCostArbitrator_.addOption(behavior, OptionFlags::INTERRUPTABLE, costEstimator_);
+        }
+    }
+
+    std::vector<DummyBehavior::Ptr> behaviors_;
+    CostEstimatorFromCostMap::Ptr costEstimator_;
+    CostArbitrator<DummyCommand> testCostArbitrator_;
+
+    Time time{Clock::now()};
+};
+
+
+TEST_P(CostArbitratorBenchmark, GetCommand) {
+    const int numOptions = GetParam();
+    const int numCycles = std::max(100, 100000 / numOptions);
+    const std::string expectedCommand = "option_" + std::to_string(numOptions / 2);
+
+    testCostArbitrator_.gainControl(time);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int cycle = 0; cycle < numCycles; ++cycle) {
+        time = time + Duration(0.01);
+        ASSERT_EQ(expectedCommand, testCostArbitrator_.getCommand(time));
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double microsecondsPerCycle = elapsed.count() / numCycles;
+    std::cout << std::fixed << std::setprecision(3) << numOptions << " options: " << microsecondsPerCycle
+              << " us per cycle (" << numCycles << " cycles)" << std::endl;
+    RecordProperty("microseconds_per_cycle", std::to_string(microsecondsPerCycle));
+}
+
+INSTANTIATE_TEST_SUITE_P(NumOptions, CostArbitratorBenchmark, ::testing::Values(10, 100, 1000));
+
+
+/// A behavior whose command takes a while to compute, e.g. because it plans a trajectory
+class SlowDummyBehavior : public DummyBehavior {
+public:
+    using DummyBehavior::DummyBehavior;
+
+    DummyCommand getCommand(const Time& time) override {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        return DummyBehavior::getCommand(time);
+    }
+};
+
+class ParallelCostArbitratorBenchmark : public ::testing::TestWithParam<std::size_t> {
+protected:
+    using OptionFlags = CostArbitrator<DummyCommand>::Option::Flags;
+
+    static constexpr int NumOptions = 8;
+    static constexpr int NumCycles = 100;
+
+    /// Returns the average time per cycle in microseconds
+    double measure(const std::size_t numThreads, const bool slowBehaviors) {
+        CostEstimatorFromCostMap::CostMap costMap;
+        for (int i = 0; i < NumOptions; ++i) {
+            costMap["option_" + std::to_string(i)] = i;
+        }
+        CostEstimatorFromCostMap::Ptr costEstimator = std::make_shared<CostEstimatorFromCostMap>(costMap);
+
+        CostArbitrator<DummyCommand> costArbitrator;
+        costArbitrator.setNumThreads(numThreads);
+        for (const auto& [name, cost] : costMap) {
+            DummyBehavior::Ptr behavior = slowBehaviors ? std::make_shared<SlowDummyBehavior>(true, false, name)
+                                                        : std::make_shared<DummyBehavior>(true, false, name);
+            costArbitrator.addOption(behavior, OptionFlags::INTERRUPTABLE, costEstimator);
+        }
+
+        Time time{Clock::now()};
+        costArbitrator.gainControl(time);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int cycle = 0; cycle < NumCycles; ++cycle) {
+            time = time + Duration(0.01);
+            EXPECT_EQ("option_0", costArbitrator.getCommand(time));
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / NumCycles;
+    }
+};
+
+TEST_P(ParallelCostArbitratorBenchmark, GetCommand) {
+    const std::size_t numThreads = GetParam();
+
+    const double sequentialSlow = measure(1, true);
+    const double parallelSlow = measure(numThreads, true);
+    const double sequentialFast = measure(1, false);
+    const double parallelFast = measure(numThreads, false);
+
+    std::cout << std::fixed << std::setprecision(3) << NumOptions << " slow options: " << sequentialSlow
+              << " us per cycle sequentially, " << parallelSlow << " us with " << numThreads << " threads" << std::endl;
+    std::cout << std::fixed << std::setprecision(3) << NumOptions << " fast options: " << sequentialFast
+              << " us per cycle sequentially, " << parallelFast << " us with " << numThreads << " threads" << std::endl;
+    RecordProperty("sequential_slow_microseconds_per_cycle", std::to_string(sequentialSlow));
+    RecordProperty("parallel_slow_microseconds_per_cycle", std::to_string(parallelSlow));
+    RecordProperty("sequential_fast_microseconds_per_cycle", std::to_string(sequentialFast));
+    RecordProperty("parallel_fast_microseconds_per_cycle", std::to_string(parallelFast));
+
+    // The behaviors sleep, so the threads overlap even on a single core
+    EXPECT_LT(parallelSlow, sequentialSlow);
+}
+
+INSTANTIATE_TEST_SUITE_P(NumThreads, ParallelCostArbitratorBenchmark, ::testing::Values(2, 4, 8));
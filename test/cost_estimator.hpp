@@ -30,4 +30,19 @@ private:
     double activationCosts_;
 };
 
+struct BatchCostEstimatorFromCostMap : public CostEstimatorFromCostMap {
+    using Ptr = std::shared_ptr<BatchCostEstimatorFromCostMap>;
+
+    using CostEstimatorFromCostMap::CostEstimatorFromCostMap;
+
+    std::vector<double> estimateCosts(const CommandRefs& commands, const std::vector<bool>& isActive) override {
+        estimateCostsCounter_++;
+        lastBatchSize_ = commands.size();
+        return CostEstimatorFromCostMap::estimateCosts(commands, isActive);
+    }
+
+    int estimateCostsCounter_{0};
+    std::size_t lastBatchSize_{0};
+};
+
 } // namespace arbitration_graphs_tests
@@ -82,3 +82,22 @@ TEST_F(DummyBehaviorTest, ToYaml) {
     EXPECT_EQ(true, yaml["invocationCondition"].as<bool>());
     EXPECT_EQ(true, yaml["commitmentCondition"].as<bool>());
 }
+
+TEST_F(DummyBehaviorTest, InputRevisions) {
+    InputRevisions revisions;
+    EXPECT_FALSE(testBehaviorTrue.inputRevisionsMatch(revisions));
+
+    InputSignal::Ptr perception = std::make_shared<InputSignal>("perception");
+    testBehaviorTrue.dependsOn(perception);
+    testBehaviorTrue.readInputRevisions(revisions);
+    const InputSignal::Revision* buffer = revisions.data();
+    EXPECT_TRUE(testBehaviorTrue.inputRevisionsMatch(revisions));
+
+    perception->notifyChanged();
+    EXPECT_FALSE(testBehaviorTrue.inputRevisionsMatch(revisions));
+
+    // Reading the revisions again reuses the existing buffer
+    testBehaviorTrue.readInputRevisions(revisions);
+    EXPECT_EQ(buffer, revisions.data());
+    EXPECT_TRUE(testBehaviorTrue.inputRevisionsMatch(revisions));
+}
@@ -223,6 +223,129 @@ TEST_F(PriorityArbitratorTest, BasicFunctionalityWithInterruptableOptions) {
     EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
 }
 
+TEST_F(PriorityArbitratorTest, EvaluationPeriod) {
+    testPriorityArbitrator.addOption(testBehaviorHighPriority, OptionFlags::INTERRUPTABLE);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::INTERRUPTABLE);
+    testPriorityArbitrator.addOption(testBehaviorLowPriority, OptionFlags::INTERRUPTABLE);
+
+    EXPECT_THROW(testPriorityArbitrator.setEvaluationPeriod(3, Duration(0.1)), InvalidArgumentsError);
+
+    // HighPriority is evaluated at 10 Hz only
+    testPriorityArbitrator.setEvaluationPeriod(0, Duration(0.1));
+
+    testPriorityArbitrator.gainControl(time);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+
+    // Within the evaluation period, the outdated invocation condition is reused
+    testBehaviorHighPriority->invocationCondition_ = true;
+    time = time + Duration(0.05);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(0, testBehaviorHighPriority->getCommandCounter_);
+
+    YAML::Node yaml = testPriorityArbitrator.toYaml(time);
+    ASSERT_TRUE(yaml["options"][0]["schedule"].IsDefined());
+    EXPECT_NEAR(0.1, yaml["options"][0]["schedule"]["period"].as<double>(), 1e-6);
+    EXPECT_NEAR(0.05, yaml["options"][0]["schedule"]["lastEvaluation"]["invocationCondition"].as<double>(), 1e-6);
+    EXPECT_FALSE(yaml["options"][0]["schedule"]["lastEvaluation"]["command"].IsDefined());
+    EXPECT_FALSE(yaml["options"][1]["schedule"].IsDefined());
+
+    // Once the period has elapsed, the option is evaluated again
+    time = time + Duration(0.1);
+    EXPECT_EQ("HighPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorHighPriority->getCommandCounter_);
+
+    // ...and its command is reused until the period elapsed again
+    time = time + Duration(0.05);
+    EXPECT_EQ("HighPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorHighPriority->getCommandCounter_);
+
+    // The reported evaluation times refer to the command and conditions themselves
+    yaml = testPriorityArbitrator.toYaml(time);
+    EXPECT_NEAR(0.05, yaml["options"][0]["schedule"]["lastEvaluation"]["command"].as<double>(), 1e-6);
+    EXPECT_NEAR(0.05, yaml["options"][0]["schedule"]["lastEvaluation"]["invocationCondition"].as<double>(), 1e-6);
+
+    time = time + Duration(0.1);
+    EXPECT_EQ("HighPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(2, testBehaviorHighPriority->getCommandCounter_);
+
+    // Without evaluation period, the option is evaluated every cycle again
+    testPriorityArbitrator.setEvaluationPeriod(0, std::nullopt);
+    testBehaviorHighPriority->invocationCondition_ = false;
+    time = time + Duration(0.01);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+
+    yaml = testPriorityArbitrator.toYaml(time);
+    EXPECT_FALSE(yaml["options"][0]["schedule"].IsDefined());
+}
+
+TEST_F(PriorityArbitratorTest, InputSignals) {
+    InputSignal::Ptr perception = std::make_shared<InputSignal>("perception");
+    testBehaviorHighPriority->dependsOn(perception);
+    testBehaviorMidPriority->dependsOn(perception);
+
+    testPriorityArbitrator.addOption(testBehaviorHighPriority, OptionFlags::INTERRUPTABLE);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::INTERRUPTABLE);
+    testPriorityArbitrator.addOption(testBehaviorLowPriority, OptionFlags::INTERRUPTABLE);
+
+    testPriorityArbitrator.gainControl(time);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorMidPriority->getCommandCounter_);
+
+    // As long as the input did not change, conditions and commands are reused, even for new time points
+    testBehaviorHighPriority->invocationCondition_ = true;
+    time = time + Duration(1);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorMidPriority->getCommandCounter_);
+    EXPECT_EQ(0, testBehaviorHighPriority->getCommandCounter_);
+
+    // Behaviors without declared inputs are evaluated as usual
+    testBehaviorLowPriority->invocationCondition_ = false;
+    EXPECT_FALSE(testPriorityArbitrator.options().at(2)->checkInvocationCondition(time));
+
+    YAML::Node yaml = testPriorityArbitrator.toYaml(time);
+    ASSERT_TRUE(yaml["options"][0]["behavior"]["inputs"].IsDefined());
+    EXPECT_EQ("perception", yaml["options"][0]["behavior"]["inputs"][0]["name"].as<std::string>());
+    EXPECT_EQ(0, yaml["options"][0]["behavior"]["inputs"][0]["revision"].as<int>());
+    EXPECT_FALSE(yaml["options"][2]["behavior"]["inputs"].IsDefined());
+
+    // Once the input changed, the behaviors are evaluated again
+    perception->notifyChanged();
+    time = time + Duration(1);
+    EXPECT_EQ("HighPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorHighPriority->getCommandCounter_);
+
+    time = time + Duration(1);
+    EXPECT_EQ("HighPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testBehaviorHighPriority->getCommandCounter_);
+}
+
+TEST_F(PriorityArbitratorTest, RestoreActiveOption) {
+    testPriorityArbitrator.addOption(testBehaviorHighPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS);
+    EXPECT_FALSE(testPriorityArbitrator.activeOptionIndex());
+
+    testPriorityArbitrator.gainControl(time);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(1, testPriorityArbitrator.activeOptionIndex());
+
+    // A restored active option is continued like one that became active regularly
+    PriorityArbitrator<DummyCommand> restoredPriorityArbitrator;
+    restoredPriorityArbitrator.addOption(testBehaviorHighPriority, OptionFlags::NO_FLAGS);
+    restoredPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    restoredPriorityArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS);
+    restoredPriorityArbitrator.restoreActiveOption(2);
+    EXPECT_TRUE(restoredPriorityArbitrator.isActive());
+    EXPECT_EQ(2, restoredPriorityArbitrator.activeOptionIndex());
+    EXPECT_TRUE(restoredPriorityArbitrator.checkCommitmentCondition(time));
+
+    restoredPriorityArbitrator.restoreActiveOption(std::nullopt);
+    EXPECT_FALSE(restoredPriorityArbitrator.isActive());
+    EXPECT_FALSE(restoredPriorityArbitrator.checkCommitmentCondition(time));
+
+    EXPECT_THROW(restoredPriorityArbitrator.restoreActiveOption(3), InvalidArgumentsError);
+}
+
 TEST(PriorityArbitrator, SubCommandTypeDiffersFromCommandType) {
     Time time{Clock::now()};
 
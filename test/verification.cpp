@@ -1,6 +1,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include "gtest/gtest.h"
 
@@ -266,3 +267,206 @@ TEST_F(CommandVerificationTest, DummyVerifierInCostArbitrator) {
 
     EXPECT_THROW(testCostArbitrator.getCommand(time), NoApplicableOptionPassedVerificationError);
 }
+
+
+struct ThrowingVerifier {
+    DummyResult analyze(const Time& /*time*/, const DummyCommand& data) const {
+        if (data == throwing_) {
+            throw std::runtime_error("ThrowingVerifier can't verify " + data);
+        }
+        return DummyResult{true};
+    };
+    std::string throwing_{"MidPriority"};
+};
+
+TEST_F(CommandVerificationTest, ThrowingVerifierInCostArbitrator) {
+    using TestCostArbitrator = CostArbitrator<DummyCommand, DummyCommand, ThrowingVerifier, DummyResult>;
+    using OptionFlags = TestCostArbitrator::Option::Flags;
+
+    TestCostArbitrator testCostArbitrator;
+
+    CostEstimatorFromCostMap::CostMap costMap{{"HighPriority", 0}, {"MidPriority", 0.5}, {"LowPriority", 1}};
+    CostEstimatorFromCostMap::Ptr costEstimator = std::make_shared<CostEstimatorFromCostMap>(costMap);
+
+    testCostArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS, costEstimator);
+    testCostArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS, costEstimator);
+
+    testCostArbitrator.gainControl(time);
+
+    // The exception only fails the option whose command threw, the other one is still rated
+    EXPECT_EQ("LowPriority", testCostArbitrator.getCommand(time));
+    ASSERT_TRUE(testCostArbitrator.options().at(0)->verificationResult_.cached(time));
+    ASSERT_TRUE(testCostArbitrator.options().at(1)->verificationResult_.cached(time));
+    EXPECT_FALSE(testCostArbitrator.options().at(0)->verificationResult_.cached(time)->isOk());
+    EXPECT_TRUE(testCostArbitrator.options().at(1)->verificationResult_.cached(time)->isOk());
+}
+
+TEST_F(CommandVerificationTest, VerificationCache) {
+    using TestPriorityArbitrator = PriorityArbitrator<DummyCommand, DummyCommand, DummyVerifier, DummyResult>;
+    using OptionFlags = TestPriorityArbitrator::Option::Flags;
+
+    TestPriorityArbitrator testPriorityArbitrator;
+
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS);
+
+    TestPriorityArbitrator::VerificationCache::Ptr verificationCache =
+        std::make_shared<TestPriorityArbitrator::VerificationCache>();
+    testPriorityArbitrator.setVerificationCache(verificationCache);
+    EXPECT_EQ(verificationCache, testPriorityArbitrator.verificationCache());
+
+    testPriorityArbitrator.gainControl(time);
+    EXPECT_EQ("LowPriority", testPriorityArbitrator.getCommand(time));
+
+    ASSERT_TRUE(verificationCache->cached("MidPriority"));
+    ASSERT_TRUE(verificationCache->cached("LowPriority"));
+    EXPECT_FALSE(verificationCache->cached("MidPriority")->isOk());
+    EXPECT_TRUE(verificationCache->cached("LowPriority")->isOk());
+
+    // The verification results of the options are still cached per time
+    ASSERT_TRUE(testPriorityArbitrator.options().at(1)->verificationResult_.cached(time));
+    EXPECT_FALSE(testPriorityArbitrator.options().at(1)->verificationResult_.cached(time)->isOk());
+
+    // Bumping the revision invalidates all results
+    verificationCache->setRevision(1);
+    EXPECT_EQ(1, verificationCache->revision());
+    EXPECT_FALSE(verificationCache->cached("MidPriority"));
+    EXPECT_FALSE(verificationCache->cached("LowPriority"));
+}
+
+TEST_F(CommandVerificationTest, VerificationCacheSkipsIdenticalCommands) {
+    struct CountingVerifier {
+        DummyResult analyze(const Time& /*time*/, const DummyCommand& /*data*/) const {
+            (*analyzeCounter_)++;
+            return DummyResult{false};
+        };
+        std::shared_ptr<int> analyzeCounter_ = std::make_shared<int>(0);
+    };
+    using TestPriorityArbitrator = PriorityArbitrator<DummyCommand, DummyCommand, CountingVerifier, DummyResult>;
+    using OptionFlags = TestPriorityArbitrator::Option::Flags;
+
+    CountingVerifier verifier;
+    TestPriorityArbitrator testPriorityArbitrator("PriorityArbitrator", verifier);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS);
+    testPriorityArbitrator.addOption(testBehaviorMidPriority, OptionFlags::FALLBACK);
+
+    testPriorityArbitrator.gainControl(time);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(3, *verifier.analyzeCounter_);
+
+    auto verificationCache = std::make_shared<TestPriorityArbitrator::VerificationCache>();
+    testPriorityArbitrator.setVerificationCache(verificationCache);
+
+    // Identical commands within the same cycle are verified only once
+    time = time + Duration(1);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(4, *verifier.analyzeCounter_);
+
+    // ...and so are identical commands in the following cycles, as long as the revision does not change
+    time = time + Duration(1);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(4, *verifier.analyzeCounter_);
+
+    verificationCache->setRevision(1);
+    time = time + Duration(1);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(5, *verifier.analyzeCounter_);
+
+    // Disable caching again
+    testPriorityArbitrator.setVerificationCache(nullptr);
+    time = time + Duration(1);
+    EXPECT_EQ("MidPriority", testPriorityArbitrator.getCommand(time));
+    EXPECT_EQ(8, *verifier.analyzeCounter_);
+}
+
+struct DummyBatchVerifier : public DummyVerifier {
+    std::vector<DummyResult> analyzeBatch(const Time& time, const std::vector<DummyCommand>& data) const {
+        (*analyzeBatchCounter_)++;
+        std::vector<DummyResult> results;
+        for (const auto& command : data) {
+            results.push_back(analyze(time, command));
+        }
+        return results;
+    };
+    std::shared_ptr<int> analyzeBatchCounter_ = std::make_shared<int>(0);
+};
+
+TEST_F(CommandVerificationTest, BatchVerifierInCostArbitrator) {
+    static_assert(verification::HasAnalyzeBatch<DummyBatchVerifier, DummyCommand>::value);
+    static_assert(!verification::HasAnalyzeBatch<DummyVerifier, DummyCommand>::value);
+
+    using TestCostArbitrator = CostArbitrator<DummyCommand, DummyCommand, DummyBatchVerifier, DummyResult>;
+    using OptionFlags = TestCostArbitrator::Option::Flags;
+
+    DummyBatchVerifier verifier;
+    TestCostArbitrator testCostArbitrator("CostArbitrator", verifier);
+
+    CostEstimatorFromCostMap::CostMap costMap{{"HighPriority", 0}, {"MidPriority", 0.5}, {"LowPriority", 1}};
+    CostEstimatorFromCostMap::Ptr costEstimator = std::make_shared<CostEstimatorFromCostMap>(costMap);
+
+    testCostArbitrator.addOption(testBehaviorHighPriority, OptionFlags::NO_FLAGS, costEstimator);
+    testCostArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS, costEstimator);
+    testCostArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS, costEstimator);
+
+    testCostArbitrator.gainControl(time);
+    EXPECT_EQ("LowPriority", testCostArbitrator.getCommand(time));
+    EXPECT_EQ(1, *verifier.analyzeBatchCounter_);
+
+    EXPECT_FALSE(testCostArbitrator.options().at(0)->verificationResult_.cached(time));
+    ASSERT_TRUE(testCostArbitrator.options().at(1)->verificationResult_.cached(time));
+    ASSERT_TRUE(testCostArbitrator.options().at(2)->verificationResult_.cached(time));
+    EXPECT_FALSE(testCostArbitrator.options().at(1)->verificationResult_.cached(time)->isOk());
+    EXPECT_TRUE(testCostArbitrator.options().at(2)->verificationResult_.cached(time)->isOk());
+
+    // With a verification cache, only uncached commands are passed on to the batch verifier
+    auto verificationCache = std::make_shared<TestCostArbitrator::VerificationCache>();
+    testCostArbitrator.setVerificationCache(verificationCache);
+    verificationCache->cache("MidPriority", DummyResult{false});
+
+    testCostArbitrator.loseControl(time);
+    time = time + Duration(1);
+    testCostArbitrator.gainControl(time);
+    EXPECT_EQ("LowPriority", testCostArbitrator.getCommand(time));
+    EXPECT_EQ(2, *verifier.analyzeBatchCounter_);
+    ASSERT_TRUE(verificationCache->cached("LowPriority"));
+    EXPECT_TRUE(verificationCache->cached("LowPriority")->isOk());
+
+    // Now all commands are cached
+    testCostArbitrator.loseControl(time);
+    time = time + Duration(1);
+    testCostArbitrator.gainControl(time);
+    EXPECT_EQ("LowPriority", testCostArbitrator.getCommand(time));
+    EXPECT_EQ(2, *verifier.analyzeBatchCounter_);
+}
+
+struct ThrowingBatchVerifier : public ThrowingVerifier {
+    std::vector<DummyResult> analyzeBatch(const Time& time, const std::vector<DummyCommand>& data) const {
+        std::vector<DummyResult> results;
+        for (const auto& command : data) {
+            results.push_back(analyze(time, command));
+        }
+        return results;
+    };
+};
+
+TEST_F(CommandVerificationTest, ThrowingBatchVerifierInCostArbitrator) {
+    using TestCostArbitrator = CostArbitrator<DummyCommand, DummyCommand, ThrowingBatchVerifier, DummyResult>;
+    using OptionFlags = TestCostArbitrator::Option::Flags;
+
+    TestCostArbitrator testCostArbitrator;
+
+    CostEstimatorFromCostMap::CostMap costMap{{"HighPriority", 0}, {"MidPriority", 0.5}, {"LowPriority", 1}};
+    CostEstimatorFromCostMap::Ptr costEstimator = std::make_shared<CostEstimatorFromCostMap>(costMap);
+
+    testCostArbitrator.addOption(testBehaviorMidPriority, OptionFlags::NO_FLAGS, costEstimator);
+    testCostArbitrator.addOption(testBehaviorLowPriority, OptionFlags::NO_FLAGS, costEstimator);
+
+    testCostArbitrator.gainControl(time);
+
+    // An exception of the batch interface can't be attributed to a single command and fails all of them
+    EXPECT_THROW(testCostArbitrator.getCommand(time), NoApplicableOptionPassedVerificationError);
+    ASSERT_TRUE(testCostArbitrator.options().at(1)->verificationResult_.cached(time));
+    EXPECT_FALSE(testCostArbitrator.options().at(1)->verificationResult_.cached(time)->isOk());
+}